@@ -18,11 +18,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
 #include <cmath>
 #include <pn/input>
 #include <pn/output>
 #include <pn/value>
 
+#include "../../c/src/common.h"
 #include "../../c/src/lex.h"
 #include "../../c/src/parse.h"
 #include "../../c/src/unicode.h"
@@ -143,10 +145,11 @@ void dump_float(pn::output_view out, double f) {
 }
 
 void dump_data(pn::output_view out, pn::data_view d) {
-    static const char hex[] = "0123456789abcdef";
+    char hex[64];
     out.write('"').check();
-    for (int i = 0; i < d.size(); ++i) {
-        out.format("{0}{1}", hex[(0xf0 & d[i]) >> 4], hex[0x0f & d[i]]);
+    for (int i = 0; i < d.size(); i += sizeof(hex) / 2) {
+        int n = std::min<int>(d.size() - i, sizeof(hex) / 2);
+        out.write(pn::string_view(hex, pn_hex(hex, d.data() + i, n, 0))).check();
     }
     out.write('"').check();
 }
@@ -32,6 +32,7 @@ typedef struct pn_map     pn_map_t;
 typedef struct pn_kv_pair pn_kv_pair_t;
 typedef struct pn_input   pn_input_t;
 typedef struct pn_output  pn_output_t;
+typedef struct pn_arena   pn_arena_t;
 
 typedef uint32_t pn_rune_t;
 
@@ -78,6 +79,8 @@ typedef enum {
     PN_ERROR_INVALID_FLOAT,
 
     PN_ERROR_RECURSION,
+
+    PN_ERROR_BINARY,
 } pn_error_code_t;
 
 struct pn_error {
@@ -88,6 +91,19 @@ struct pn_error {
 
 const char* pn_strerror(pn_error_code_t code);
 
+// Memory owned by values, inputs, parsers and arenas is obtained from the current allocator, which
+// defaults to malloc(), realloc() and free(). Replace it only while no such memory is live, since
+// anything allocated before the change would later be released through the new allocator.
+typedef struct {
+    void* (*alloc)(void* context, size_t size);
+    void* (*realloc)(void* context, void* ptr, size_t size);
+    void (*free)(void* context, void* ptr);
+    void* context;
+} pn_allocator_t;
+
+void                  pn_set_allocator(const pn_allocator_t* allocator);  // NULL for the default
+const pn_allocator_t* pn_get_allocator(void);
+
 typedef enum {
     PN_NULL   = 0,
     PN_BOOL   = 1,
@@ -185,9 +201,146 @@ size_t pn_rune_next(const char* data, size_t size, size_t index);
 // Requires: 0 < *index <= size
 size_t pn_rune_prev(const char* data, size_t size, size_t index);
 
-size_t pn_rune_width(pn_rune_t rune);
 size_t pn_str_width(const char* data, size_t size);
 
+// Unicode properties of each rune: its general category in the low six bits, and whether it is
+// wide in the next. Stored as a two-stage table, so the classifiers below have inline versions,
+// named with `_inline`, for hot loops: the page of a rune selects one of the distinct leaves, and
+// the leaf holds one byte per rune.
+enum {
+    PN_RUNE_OTHER              = 000,  // C
+    PN_RUNE_OTHER_CONTROL      = 000,  // Cc
+    PN_RUNE_OTHER_FORMAT       = 001,  // Cf
+    PN_RUNE_OTHER_NOT_ASSIGNED = 002,  // Cn
+    PN_RUNE_OTHER_PRIVATE_USE  = 003,  // Co
+    PN_RUNE_OTHER_SURROGATE    = 004,  // Cs
+
+    PN_RUNE_LETTER           = 010,  // L
+    PN_RUNE_LETTER_LOWERCASE = 010,  // Ll
+    PN_RUNE_LETTER_MODIFIER  = 011,  // Lm
+    PN_RUNE_LETTER_OTHER     = 012,  // Lo
+    PN_RUNE_LETTER_TITLECASE = 013,  // Lt
+    PN_RUNE_LETTER_UPPERCASE = 014,  // Lu
+
+    PN_RUNE_MODIFIER                   = 020,  // M
+    PN_RUNE_MODIFIER_SPACING_COMBINING = 020,  // Mc
+    PN_RUNE_MODIFIER_ENCLOSING         = 021,  // Me
+    PN_RUNE_MODIFIER_NONSPACING        = 022,  // Mn
+
+    PN_RUNE_NUMBER               = 030,  // N
+    PN_RUNE_NUMBER_DECIMAL_DIGIT = 030,  // Nd
+    PN_RUNE_NUMBER_LETTER        = 031,  // Nl
+    PN_RUNE_NUMBER_OTHER         = 032,  // No
+
+    PN_RUNE_PUNCTUATION               = 040,  // P
+    PN_RUNE_PUNCTUATION_CONNECTOR     = 040,  // Pc
+    PN_RUNE_PUNCTUATION_DASH          = 041,  // Pd
+    PN_RUNE_PUNCTUATION_CLOSE         = 042,  // Pe
+    PN_RUNE_PUNCTUATION_FINAL_QUOTE   = 043,  // Pf
+    PN_RUNE_PUNCTUATION_INITIAL_QUOTE = 044,  // Pi
+    PN_RUNE_PUNCTUATION_OTHER         = 045,  // Po
+    PN_RUNE_PUNCTUATION_OPEN          = 046,  // Ps
+
+    PN_RUNE_SYMBOL          = 050,  // S
+    PN_RUNE_SYMBOL_CURRENCY = 050,  // Sc
+    PN_RUNE_SYMBOL_MODIFIER = 051,  // Sk
+    PN_RUNE_SYMBOL_MATH     = 052,  // Sm
+    PN_RUNE_SYMBOL_OTHER    = 053,  // So
+
+    PN_RUNE_SEPARATOR           = 060,  // Z
+    PN_RUNE_SEPARATOR_LINE      = 060,  // Zl
+    PN_RUNE_SEPARATOR_PARAGRAPH = 061,  // Zp
+    PN_RUNE_SEPARATOR_SPACE     = 062,  // Zs
+
+    PN_RUNE_HALFWIDTH = 0000,  // A H N Na
+    PN_RUNE_FULLWIDTH = 0100,  // F W
+
+    PN_RUNE_CATEGORY       = 0077,
+    PN_RUNE_MAJOR_CATEGORY = 0070,
+    PN_RUNE_LEAF_BITS      = 7,
+};
+
+extern const uint8_t pn_rune_pages[0x110000 >> PN_RUNE_LEAF_BITS];
+extern const int8_t  pn_rune_leaves[][1 << PN_RUNE_LEAF_BITS];
+
+static inline bool pn_isrune_inline(pn_rune_t r) { return r < 0x110000; }
+
+// Runes past the end of Unicode are unassigned.
+static inline int pn_rune_props(pn_rune_t r) {
+    if (!pn_isrune_inline(r)) {
+        return PN_RUNE_OTHER_NOT_ASSIGNED;
+    }
+    return pn_rune_leaves[pn_rune_pages[r >> PN_RUNE_LEAF_BITS]]
+                         [r & ((1 << PN_RUNE_LEAF_BITS) - 1)];
+}
+
+static inline size_t pn_rune_width_inline(pn_rune_t r) {
+    if (r < 0x80) {
+        return 1;
+    }
+    int x = pn_rune_props(r);
+    switch (x & PN_RUNE_MAJOR_CATEGORY) {
+        case PN_RUNE_OTHER: return 1;
+        case PN_RUNE_MODIFIER: return 0;
+    }
+    return (x & PN_RUNE_FULLWIDTH) ? 2 : 1;
+}
+
+static inline bool pn_rune_is(pn_rune_t r, int mask, int category) {
+    return (pn_rune_props(r) & mask) == category;
+}
+
+static inline bool pn_isalnum_inline(pn_rune_t r) {
+    return pn_rune_is(r, PN_RUNE_MAJOR_CATEGORY, PN_RUNE_LETTER) ||
+           pn_rune_is(r, PN_RUNE_MAJOR_CATEGORY, PN_RUNE_NUMBER);
+}
+
+static inline bool pn_isalpha_inline(pn_rune_t r) {
+    return pn_rune_is(r, PN_RUNE_MAJOR_CATEGORY, PN_RUNE_LETTER);
+}
+
+static inline bool pn_iscntrl_inline(pn_rune_t r) {
+    return pn_rune_is(r, PN_RUNE_CATEGORY, PN_RUNE_OTHER_CONTROL);
+}
+
+static inline bool pn_isdigit_inline(pn_rune_t r) {
+    return pn_rune_is(r, PN_RUNE_CATEGORY, PN_RUNE_NUMBER_DECIMAL_DIGIT);
+}
+
+static inline bool pn_islower_inline(pn_rune_t r) {
+    return pn_rune_is(r, PN_RUNE_CATEGORY, PN_RUNE_LETTER_LOWERCASE);
+}
+
+static inline bool pn_isnumeric_inline(pn_rune_t r) {
+    return pn_rune_is(r, PN_RUNE_MAJOR_CATEGORY, PN_RUNE_NUMBER);
+}
+
+static inline bool pn_isprint_inline(pn_rune_t r) {
+    if (r < 0x80) {
+        return (' ' <= r) && (r <= '~');
+    }
+    return !pn_rune_is(r, PN_RUNE_MAJOR_CATEGORY, PN_RUNE_OTHER);
+}
+
+static inline bool pn_ispunct_inline(pn_rune_t r) {
+    return pn_rune_is(r, PN_RUNE_MAJOR_CATEGORY, PN_RUNE_PUNCTUATION);
+}
+
+static inline bool pn_isspace_inline(pn_rune_t r) {
+    return pn_rune_is(r, PN_RUNE_MAJOR_CATEGORY, PN_RUNE_SEPARATOR);
+}
+
+static inline bool pn_isupper_inline(pn_rune_t r) {
+    return pn_rune_is(r, PN_RUNE_CATEGORY, PN_RUNE_LETTER_UPPERCASE);
+}
+
+static inline bool pn_istitle_inline(pn_rune_t r) {
+    return pn_rune_is(r, PN_RUNE_CATEGORY, PN_RUNE_LETTER_TITLECASE);
+}
+
+// Out-of-line versions of the above.
+size_t pn_rune_width(pn_rune_t rune);
+
 bool pn_isrune(pn_rune_t r);
 
 bool pn_isalnum(pn_rune_t r);    // Abc123あいう英美四㊀㊁㊂
@@ -223,6 +376,11 @@ struct pn_kv_pair {
 };
 
 // Sequence of (string key, value) pairs.
+//
+// Maps with more than a handful of entries carry a hash index over their keys, which is kept up
+// to date by the pn_map*() functions below. Code that edits `values` directly must call
+// pn_mapreindex() before the next lookup. The index is stored apart from the map, so maps must
+// only be allocated and freed by the library.
 struct pn_map {
     size_t       count;
     size_t       size;
@@ -232,6 +390,7 @@ struct pn_map {
 pn_map_t* pn_mapdup(const pn_map_t* m);
 void      pn_mapfree(pn_map_t* m);
 int       pn_mapcmp(const pn_map_t* m1, const pn_map_t* m2);
+void      pn_mapreindex(pn_map_t* m);
 // Returns NULL if not found (note: different from &pn_null).
 pn_value_t*       pn_mapget(pn_map_t* m, int key_format, ...);
 const pn_value_t* pn_mapget_const(const pn_map_t* m, int key_format, ...);
@@ -247,6 +406,7 @@ typedef enum {
     PN_INPUT_TYPE_C_FILE  = 1,
     PN_INPUT_TYPE_STDIN   = 2,
     PN_INPUT_TYPE_VIEW    = 5,
+    PN_INPUT_TYPE_MMAP    = 8,
 } pn_input_type_t;
 
 struct pn_input {
@@ -264,18 +424,78 @@ typedef enum {
     PN_OUTPUT_TYPE_STDERR  = 4,
     PN_OUTPUT_TYPE_DATA    = 6,
     PN_OUTPUT_TYPE_STRING  = 7,
+    PN_OUTPUT_TYPE_BUFFER  = 8,
 } pn_output_type_t;
 
 struct pn_output {
     pn_output_type_t type;
     union {
-        FILE*         c_file;
-        pn_data_t**   data;
-        pn_string_t** string;
+        FILE*                    c_file;
+        pn_data_t**              data;
+        pn_string_t**            string;
+        struct pn_output_buffer* buffer;
     };
 };
 
 bool pn_parse(pn_input_t* input, pn_value_t* out, pn_error_t* error);
+// Like pn_parse(), but splits a large long-form document at its top-level items (lines at column 0
+// that start a key or `*`) and parses the pieces on up to `threads` threads, or one per CPU if 0.
+// Only inputs from pn_view_input() and pn_mmap_input() are split; others are parsed serially, as
+// is any document that fails to parse, so errors are reported exactly as pn_parse() reports them.
+// The allocator set with pn_set_allocator() must be thread-safe.
+bool pn_parse_parallel(pn_input_t* input, size_t threads, pn_value_t* out, pn_error_t* error);
+
+// Streaming parser. Reports a document as a sequence of events instead of building a tree: a
+// scalar, or the start or end of an array or map. Events for the children of a map carry their
+// key in `k`; otherwise `k` is null. Scalars are in `x`.
+typedef enum {
+    PN_EVT_NULL = 0,
+    PN_EVT_BOOL,
+    PN_EVT_INT,
+    PN_EVT_FLOAT,
+    PN_EVT_DATA,
+    PN_EVT_STRING,
+    PN_EVT_ARRAY_IN,
+    PN_EVT_ARRAY_OUT,
+    PN_EVT_MAP_IN,
+    PN_EVT_MAP_OUT,
+    PN_EVT_ERROR,
+} pn_event_type_t;
+
+typedef enum {
+    PN_EVT_SHORT = 1 << 0,  // written inline: 1, "str", [...], {...}
+    PN_EVT_LONG  = 1 << 1,  // written in block form: * item, key: value, | line
+} pn_event_flag_t;
+
+typedef struct {
+    pn_event_type_t type;
+    uint8_t         flags;
+    pn_value_t      k;
+    pn_value_t      x;
+} pn_event_t;
+
+typedef struct pn_reader pn_reader_t;
+
+// The reader keeps `input`, which must outlive it.
+pn_reader_t* pn_reader_new(pn_input_t* input);
+void         pn_reader_free(pn_reader_t* reader);
+// Returns true if it read an event. Returns false at the end of input, or on error, in which
+// case `error` is set and the current event has type PN_EVT_ERROR.
+bool pn_reader_next(pn_reader_t* reader, pn_error_t* error);
+// If the last event was ARRAY_IN or MAP_IN, skips to the end of that array or map, whose ARRAY_OUT
+// or MAP_OUT becomes the current event; otherwise, does nothing. Long-form containers are skipped
+// by their lines' indentation, and short-form ones by matching brackets, so their contents are
+// neither allocated nor checked for errors. Returns false on error, as pn_reader_next() does.
+bool pn_reader_skip(pn_reader_t* reader, pn_error_t* error);
+// The event last read. Its values are valid until the next call to pn_reader_next().
+const pn_event_t* pn_reader_event(const pn_reader_t* reader);
+
+// Arenas own the trees produced by pn_parse_arena(), which are allocated in bulk and released all
+// at once by pn_arena_free(). Values in such a tree must not be modified or passed to pn_clear().
+pn_arena_t* pn_arena_new(void);
+void        pn_arena_free(pn_arena_t* arena);
+// Like pn_parse(), but allocates the tree in `arena`. `out` is overwritten without being cleared.
+bool pn_parse_arena(pn_input_t* input, pn_arena_t* arena, pn_value_t* out, pn_error_t* error);
 
 enum {
     PN_DUMP_DEFAULT = 0,
@@ -283,6 +503,61 @@ enum {
 };
 bool pn_dump(pn_output_t* output, int flags, int format, ...);
 
+// Binary encoding, for caches and for passing values between programs. Each value begins with a
+// one-byte tag. Integers follow as zigzag varints (LEB128); floats as 8 little-endian bytes of
+// their IEEE representation; data and strings as a varint byte count and the bytes; arrays as a
+// varint count and the elements; and maps as a varint count and the pairs, each key as a varint
+// byte count and the bytes, followed by its value.
+enum {
+    PN_BINARY_NULL   = 0,
+    PN_BINARY_FALSE  = 1,
+    PN_BINARY_TRUE   = 2,
+    PN_BINARY_INT    = 3,
+    PN_BINARY_FLOAT  = 4,
+    PN_BINARY_DATA   = 5,
+    PN_BINARY_STRING = 6,
+    PN_BINARY_ARRAY  = 7,
+    PN_BINARY_MAP    = 8,
+};
+bool pn_dump_binary(pn_output_t* output, const pn_value_t* x);
+// Reads the whole of `input` as one binary-encoded value. Binary input has no lines, so on error
+// `error->lineno` is 0 and `error->column` counts bytes from 1, like columns of text: it is one
+// more than the offset at which decoding failed. Both are 0 if `input` couldn't be read. Strings
+// aren't checked for valid UTF-8.
+bool pn_parse_binary(pn_input_t* input, pn_value_t* out, pn_error_t* error);
+
+// Frozen documents: a read-only layout of a value that is used where it lies, without decoding,
+// so it can be mapped from a file and shared between processes. Offsets count from the start of
+// the document; fields are native-endian and 8-byte aligned. A document is PN_FROZEN_MAGIC and
+// the root value. Data and strings point to their byte count and bytes, strings with a trailing
+// NUL. Arrays point to their count and elements. Maps point to their count, their entries in
+// order, and the indexes of the entries ordered by key, for binary search.
+#define PN_FROZEN_MAGIC 0x314e5a4f52464e50ull  // "PNFROZN1", little-endian
+
+typedef struct pn_frozen_value {
+    uint64_t type;  // pn_type_t
+    union {
+        uint64_t b;
+        int64_t  i;
+        double   f;
+        uint64_t offset;  // of the body of data, strings, arrays and maps
+    };
+} pn_frozen_value_t;
+
+typedef struct pn_frozen_entry {
+    uint64_t          key;  // offset of a string body
+    pn_frozen_value_t value;
+} pn_frozen_entry_t;
+
+bool pn_dump_frozen(pn_output_t* output, const pn_value_t* x);
+// Returns the root of the frozen document at `data`, or NULL if `data` isn't 8-byte aligned or
+// doesn't start with a frozen document. Only the header is checked, so opening is O(1); the rest
+// must be as pn_dump_frozen() wrote it.
+const pn_frozen_value_t* pn_frozen_root(const void* data, size_t size);
+// Returns the value for `key` in the map `m` of document `doc`, or NULL if there is none.
+const pn_frozen_value_t* pn_frozen_mapget(
+        const void* doc, const pn_frozen_value_t* m, const char* key, size_t size);
+
 typedef enum {
     PN_TEXT          = 0,
     PN_BINARY        = 1,
@@ -295,6 +570,9 @@ pn_input_t pn_file_input(FILE* f);
 pn_input_t pn_data_input(const pn_data_t* d);
 pn_input_t pn_string_input(const pn_string_t* s);
 pn_input_t pn_view_input(const void* data, size_t size);
+// Maps the file at `path` read-only and reads from the mapping. Where mmap() is unavailable, opens
+// the file with pn_path_input() instead.
+pn_input_t pn_mmap_input(const char* path);
 
 pn_output_t pn_path_output(const char* path, pn_path_flags_t flags);
 pn_output_t pn_file_output(FILE* f);
@@ -94,6 +94,15 @@ def output_c(lex, parser):
         index += len(table)
     yield "};"
 
+    yield
+    yield "const char* const lex_runs[] = {"
+    for stops in lex.runs:
+        if stops is None:
+            yield "    NULL,"
+        else:
+            yield "    \"%s\"," % "".join(("\\" + c) if c in "\"\\" else c for c in stops)
+    yield "};"
+
     yield
     yield "pn_parser_transition_t parse_defs[] = {"
     for _, parse_def in parser.defs.values():
@@ -207,6 +216,7 @@ class Lexer:
 
         states = OrderedDict((state, i) for i, state in enumerate(lex))
         self.tables = [Lexer.build_lex_table(lex[state], spec, states) for state in states]
+        self.runs = [Lexer.find_run(i, table) for i, table in enumerate(self.tables)]
         self.partitions = Lexer.partition_lex(self.tables)
 
     @staticmethod
@@ -253,6 +263,19 @@ class Lexer:
 
         return out
 
+    @staticmethod
+    def find_run(index, table):
+        """Finds the bytes that end a run of printable ASCII in a state.
+
+        If a state stays put on all but a few printable ASCII bytes, like the body of a string or
+        comment, the lexer can skip over runs of the rest without stepping through the table.
+        Returns the exceptions, or None if the state doesn't have runs worth skipping.
+        """
+        stops = [chr(i) for i in range(0o040, 0o177) if table[i] != ("next", index)]
+        if len(stops) > 2:
+            return None
+        return stops
+
     @staticmethod
     def partition_lex(table):
         outs = collections.defaultdict(list)
@@ -110,47 +110,48 @@ def main():
         for cp in range(first, last + 1):
             data[cp] = (data[cp] & 0o100) | CATEGORY[category]
 
-    size = print_level("data", data)
+    size = print_table(data)
     print("// %d bytes" % size)
 
 
-def print_level(name, values, level=0):
-    block_size = 8
-    if level == 0:
-        ctype = "int8_t"
-        csize = 1
-    elif max(values) < 256:
-        ctype = "uint8_t"
-        csize = 1
-    elif max(values) < 65536:
-        ctype = "uint16_t"
-        csize = 2
-    else:
-        ctype = "uint32_t"
-        csize = 4
-
-    if len(values) > (block_size * 1.5):
-        blocks = set()
-        next_values = []
-        for i in range(0, len(values), block_size):
-            block = tuple(values[i:i + block_size])
-            while len(block) < block_size:
-                block = block + (0, )
-            if block not in blocks:
-                blocks.add(block)
-            next_values.append(block)
-        blocks = {block: index for index, block in enumerate(sorted(blocks))}
-
-        print("static const %s %s_%d[][%d] = {" % (ctype, name, level, block_size))
-        for block, index in sorted(blocks.items()):
-            print("        [%d] = {%s}," % (index, ", ".join(map(str, block))))
-        print("};")
-        return (csize * block_size * len(blocks)) + print_level(
-            name, [blocks.get(x) for x in next_values], level + 1)
-    else:
-        print("static const %s %s_%d[] = {%s};" %
-              (ctype, name, level, ", ".join(map(str, values))))
-        return csize * len(values)
+def print_table(values, leaf_bits=7):
+    """Prints a two-stage table: a page index, and the distinct leaves it points to.
+
+    Looking up a rune costs two dependent loads: pn_rune_pages[r >> leaf_bits] picks a leaf, and
+    the leaf holds one byte per rune. 128-rune leaves minimize the total size; there are few enough
+    distinct ones that a byte indexes them.
+    """
+    leaf_size = 1 << leaf_bits
+    leaves = {}
+    pages = []
+    for i in range(0, len(values), leaf_size):
+        leaf = tuple(values[i:i + leaf_size])
+        pages.append(leaves.setdefault(leaf, len(leaves)))
+    assert len(leaves) <= 256
+
+    print("const uint8_t pn_rune_pages[0x110000 >> PN_RUNE_LEAF_BITS] = {")
+    print_values(pages)
+    print("};")
+    print()
+    print("const int8_t pn_rune_leaves[][1 << PN_RUNE_LEAF_BITS] = {")
+    for leaf, index in leaves.items():
+        print("        [%d] = {" % index)
+        print_values(leaf, indent=16)
+        print("        },")
+    print("};")
+    return len(pages) + (leaf_size * len(leaves))
+
+
+def print_values(values, indent=8, width=99):
+    line = ""
+    for v in values:
+        item = "%d," % v
+        if line and (indent + len(line) + 1 + len(item) > width):
+            print(" " * indent + line)
+            line = ""
+        line = (line + " " + item) if line else item
+    if line:
+        print(" " * indent + line)
 
 
 def cache_unidata():
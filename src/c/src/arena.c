@@ -0,0 +1,123 @@
+// Copyright 2026 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define PN_ARENA_ALIGN 16
+#define PN_ARENA_BLOCK_MIN 4096
+#define PN_ARENA_BLOCK_MAX (1 << 20)
+
+struct pn_arena_block {
+    struct pn_arena_block* next;
+    size_t                 size;
+    size_t                 used;
+    char                   data[];
+};
+
+// Allocations are carved from the head block. Blocks double in size up to a limit; an allocation
+// too large for a fresh block gets a block to itself, linked behind the head so that the head's
+// free space isn't abandoned.
+struct pn_arena {
+    struct pn_arena_block* head;
+    size_t                 next_size;
+};
+
+pn_arena_t* pn_arena_new(void) {
+    pn_arena_t* arena = pn_malloc(sizeof(pn_arena_t));
+    arena->head       = NULL;
+    arena->next_size  = PN_ARENA_BLOCK_MIN;
+    return arena;
+}
+
+void pn_arena_free(pn_arena_t* arena) {
+    if (!arena) {
+        return;
+    }
+    struct pn_arena_block* b = arena->head;
+    while (b) {
+        struct pn_arena_block* next = b->next;
+        pn_free(b);
+        b = next;
+    }
+    pn_free(arena);
+}
+
+static size_t block_align(const struct pn_arena_block* b, size_t offset) {
+    uintptr_t at = (uintptr_t)(b->data + offset);
+    return offset + (-at & (PN_ARENA_ALIGN - 1));
+}
+
+void* pn_arena_alloc(pn_arena_t* arena, size_t size) {
+    struct pn_arena_block* b = arena->head;
+    if (b) {
+        size_t offset = block_align(b, b->used);
+        if ((offset <= b->size) && (size <= (b->size - offset))) {
+            b->used = offset + size;
+            return b->data + offset;
+        }
+    }
+
+    size_t block_size = arena->next_size;
+    if ((size + PN_ARENA_ALIGN) > block_size) {
+        block_size = size + PN_ARENA_ALIGN;
+    } else if (arena->next_size < PN_ARENA_BLOCK_MAX) {
+        arena->next_size *= 2;
+    }
+
+    b       = pn_malloc(sizeof(struct pn_arena_block) + block_size);
+    b->size = block_size;
+    b->used = block_align(b, 0) + size;
+    if (arena->head && (block_size > arena->next_size)) {
+        b->next           = arena->head->next;
+        arena->head->next = b;
+    } else {
+        b->next     = arena->head;
+        arena->head = b;
+    }
+    return b->data + block_align(b, 0);
+}
+
+pn_string_t* pn_arena_string(pn_arena_t* arena, const char* src, size_t len) {
+    size_t       size = sizeof(pn_string_t) + len + 1;
+    pn_string_t* s    = pn_arena_alloc(arena, size);
+    s->count          = len + 1;
+    s->size           = size;
+    if (src && len) {
+        memcpy(s->values, src, len);
+    }
+    s->values[len] = '\0';
+    return s;
+}
+
+pn_data_t* pn_arena_data(pn_arena_t* arena, const uint8_t* src, size_t len) {
+    size_t     size = sizeof(pn_data_t) + len;
+    pn_data_t* d    = pn_arena_alloc(arena, size);
+    d->count        = len;
+    d->size         = size;
+    if (src && len) {
+        memcpy(d->values, src, len);
+    }
+    return d;
+}
+
+pn_array_t* pn_arena_array(pn_arena_t* arena, size_t count) {
+    size_t      size = sizeof(pn_array_t) + (count * sizeof(pn_value_t));
+    pn_array_t* a    = pn_arena_alloc(arena, size);
+    a->count         = count;
+    a->size          = size;
+    return a;
+}
@@ -0,0 +1,286 @@
+// Copyright 2017 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <pn/procyon.h>
+
+#include <string.h>
+
+#include "./common.h"
+#include "./io.h"
+#include "./vector.h"
+
+#define PN_BINARY_DEPTH_MAX 64
+
+static bool write_varint(pn_output_t* out, uint64_t u) {
+    uint8_t b[10];
+    size_t  n = 0;
+    while (u >= 0x80) {
+        b[n++] = (uint8_t)u | 0x80;
+        u >>= 7;
+    }
+    b[n++] = (uint8_t)u;
+    return pn_buffered_write(out, b, n);
+}
+
+static bool write_bytes(pn_output_t* out, const void* data, size_t size) {
+    return write_varint(out, size) && pn_buffered_write(out, data, size);
+}
+
+static bool write_value(pn_output_t* out, const pn_value_t* x) {
+    switch (x->type) {
+        case PN_NULL: return pn_buffered_putc(out, PN_BINARY_NULL);
+        case PN_BOOL: return pn_buffered_putc(out, x->b ? PN_BINARY_TRUE : PN_BINARY_FALSE);
+
+        case PN_INT: {
+            uint64_t u = (uint64_t)x->i;
+            return pn_buffered_putc(out, PN_BINARY_INT) &&
+                   write_varint(out, (u << 1) ^ ((x->i < 0) ? ~(uint64_t)0 : 0));
+        }
+
+        case PN_FLOAT: {
+            uint64_t u;
+            memcpy(&u, &x->f, sizeof(u));
+            uint8_t b[9] = {PN_BINARY_FLOAT};
+            for (int i = 0; i < 8; ++i) {
+                b[i + 1] = (uint8_t)(u >> (8 * i));
+            }
+            return pn_buffered_write(out, b, sizeof(b));
+        }
+
+        case PN_DATA:
+            return pn_buffered_putc(out, PN_BINARY_DATA) &&
+                   write_bytes(out, x->d->values, x->d->count);
+
+        case PN_STRING:
+            return pn_buffered_putc(out, PN_BINARY_STRING) &&
+                   write_bytes(out, x->s->values, x->s->count - 1);
+
+        case PN_ARRAY:
+            if (!(pn_buffered_putc(out, PN_BINARY_ARRAY) && write_varint(out, x->a->count))) {
+                return false;
+            }
+            for (size_t i = 0; i < x->a->count; ++i) {
+                if (!write_value(out, &x->a->values[i])) {
+                    return false;
+                }
+            }
+            return true;
+
+        case PN_MAP:
+            if (!(pn_buffered_putc(out, PN_BINARY_MAP) && write_varint(out, x->m->count))) {
+                return false;
+            }
+            for (size_t i = 0; i < x->m->count; ++i) {
+                const pn_kv_pair_t* kv = &x->m->values[i];
+                if (!(write_bytes(out, kv->key->values, kv->key->count - 1) &&
+                      write_value(out, &kv->value))) {
+                    return false;
+                }
+            }
+            return true;
+    }
+    return false;
+}
+
+bool pn_dump_binary(pn_output_t* out, const pn_value_t* x) {
+    struct pn_output_buffer buf;
+    pn_output_t             buffered = pn_buffered_output(out, &buf);
+    bool                    result   = write_value(&buffered, x);
+    return pn_output_flush(&buf) && result;
+}
+
+typedef struct {
+    const uint8_t* begin;
+    const uint8_t* data;
+    const uint8_t* end;
+    int            depth;
+    pn_error_t*    error;
+} binary_reader_t;
+
+static bool fail(binary_reader_t* r, pn_error_code_t code) {
+    r->error->code   = code;
+    r->error->lineno = 0;
+    r->error->column = r->data - r->begin + 1;
+    return false;
+}
+
+static bool read_varint(binary_reader_t* r, uint64_t* u) {
+    *u = 0;
+    for (int shift = 0; (shift < 64) && (r->data < r->end); shift += 7) {
+        uint8_t b = *(r->data++);
+        if ((shift == 63) && (b > 1)) {
+            break;
+        }
+        *u |= (uint64_t)(b & 0x7f) << shift;
+        if (!(b & 0x80)) {
+            return true;
+        }
+    }
+    return fail(r, PN_ERROR_BINARY);
+}
+
+// Reads a length, which must not run past the end of the input. Containers hold at least one byte
+// per element, so their counts are checked the same way before anything is allocated.
+static bool read_size(binary_reader_t* r, size_t* size) {
+    uint64_t u;
+    if (!read_varint(r, &u)) {
+        return false;
+    } else if (u > (uint64_t)(r->end - r->data)) {
+        return fail(r, PN_ERROR_BINARY);
+    }
+    *size = u;
+    return true;
+}
+
+// On failure, leaves `x` in a state that pn_clear() can release.
+static bool read_value(binary_reader_t* r, pn_value_t* x) {
+    x->type = PN_NULL;
+    if (r->data == r->end) {
+        return fail(r, PN_ERROR_BINARY);
+    }
+    uint64_t u;
+    size_t   size;
+    switch (*(r->data++)) {
+        case PN_BINARY_NULL: x->type = PN_NULL; return true;
+        case PN_BINARY_FALSE: x->type = PN_BOOL, x->b = false; return true;
+        case PN_BINARY_TRUE: x->type = PN_BOOL, x->b = true; return true;
+
+        case PN_BINARY_INT:
+            if (!read_varint(r, &u)) {
+                return false;
+            }
+            x->type = PN_INT;
+            x->i    = (int64_t)((u >> 1) ^ (~(u & 1) + 1));
+            return true;
+
+        case PN_BINARY_FLOAT:
+            if ((r->end - r->data) < 8) {
+                return fail(r, PN_ERROR_BINARY);
+            }
+            u = 0;
+            for (int i = 0; i < 8; ++i) {
+                u |= (uint64_t)r->data[i] << (8 * i);
+            }
+            r->data += 8;
+            x->type = PN_FLOAT;
+            memcpy(&x->f, &u, sizeof(u));
+            return true;
+
+        case PN_BINARY_DATA:
+            if (!read_size(r, &size)) {
+                return false;
+            }
+            x->type = PN_DATA;
+            x->d    = pn_data_new(r->data, size);
+            r->data += size;
+            return true;
+
+        case PN_BINARY_STRING:
+            if (!read_size(r, &size)) {
+                return false;
+            }
+            x->type = PN_STRING;
+            x->s    = pn_string_new((const char*)r->data, size);
+            r->data += size;
+            return true;
+
+        case PN_BINARY_ARRAY:
+            if (!read_size(r, &size)) {
+                return false;
+            } else if (++r->depth >= PN_BINARY_DEPTH_MAX) {
+                return fail(r, PN_ERROR_RECURSION);
+            }
+            x->type = PN_ARRAY;
+            VECTOR_INIT(&x->a, size);
+            for (size_t i = 0; i < size; ++i) {
+                if (!read_value(r, &x->a->values[i])) {
+                    x->a->count = i + 1;
+                    return false;
+                }
+            }
+            --r->depth;
+            return true;
+
+        case PN_BINARY_MAP:
+            if (!read_size(r, &size)) {
+                return false;
+            } else if (++r->depth >= PN_BINARY_DEPTH_MAX) {
+                return fail(r, PN_ERROR_RECURSION);
+            }
+            x->type     = PN_MAP;
+            x->m        = pn_map_new(size);
+            x->m->count = 0;
+            for (size_t i = 0; i < size; ++i) {
+                size_t key_size;
+                if (!read_size(r, &key_size)) {
+                    return false;
+                }
+                pn_string_t* key = pn_string_new((const char*)r->data, key_size);
+                r->data += key_size;
+                pn_value_t value;
+                if (!read_value(r, &value)) {
+                    pn_free(key);
+                    pn_clear(&value);
+                    return false;
+                }
+                // A later duplicate key replaces the earlier value, as in pn_parse().
+                pn_mapappend(&x->m, key, &value);
+            }
+            --r->depth;
+            return true;
+
+        default: --r->data; return fail(r, PN_ERROR_BINARY);
+    }
+}
+
+static bool parse_binary(
+        const uint8_t* data, size_t size, pn_value_t* out, pn_error_t* error) {
+    binary_reader_t r = {data, data, data + size, 0, error};
+    pn_value_t      x;
+    if (!read_value(&r, &x)) {
+        pn_clear(&x);
+        return false;
+    } else if (r.data != r.end) {
+        pn_clear(&x);
+        return fail(&r, PN_ERROR_BINARY);
+    }
+    pn_set(out, 'X', &x);
+    return true;
+}
+
+bool pn_parse_binary(pn_input_t* in, pn_value_t* out, pn_error_t* error) {
+    pn_error_t ignore_error;
+    error = error ? error : &ignore_error;
+
+    if ((in->type == PN_INPUT_TYPE_VIEW) || (in->type == PN_INPUT_TYPE_MMAP)) {
+        struct pn_input_view* view = in->view;
+        bool result = parse_binary(view->data ? view->data : "", view->size, out, error);
+        view->data  = NULL;
+        view->size  = 0;
+        return result;
+    }
+
+    pn_data_t* d = pn_data_new(NULL, 0);
+    bool       result;
+    if (pn_read_all_data(in, &d)) {
+        result = parse_binary(d->values, d->count, out, error);
+    } else {
+        error->code   = PN_ERROR_SYSTEM;
+        error->lineno = 0;
+        error->column = 0;
+        result        = false;
+    }
+    pn_free(d);
+    return result;
+}
@@ -19,6 +19,38 @@
 #include "./unicode.h"
 #include "./vector.h"
 
+static void* default_alloc(void* context, size_t size) {
+    (void)context;
+    return malloc(size);
+}
+
+static void* default_realloc(void* context, void* ptr, size_t size) {
+    (void)context;
+    return realloc(ptr, size);
+}
+
+static void default_free(void* context, void* ptr) {
+    (void)context;
+    free(ptr);
+}
+
+static const pn_allocator_t default_allocator = {default_alloc, default_realloc, default_free};
+static pn_allocator_t       allocator         = {default_alloc, default_realloc, default_free};
+
+void pn_set_allocator(const pn_allocator_t* a) { allocator = a ? *a : default_allocator; }
+const pn_allocator_t* pn_get_allocator(void) { return &allocator; }
+
+void* pn_malloc(size_t size) { return allocator.alloc(allocator.context, size); }
+void* pn_realloc(void* ptr, size_t size) {
+    return ptr ? allocator.realloc(allocator.context, ptr, size) : pn_malloc(size);
+}
+
+void pn_free(void* ptr) {
+    if (ptr) {
+        allocator.free(allocator.context, ptr);
+    }
+}
+
 pn_string_t* pn_string_new(const char* src, size_t len) {
     pn_string_t* s;
     VECTOR_INIT(&s, len + 1);
@@ -70,6 +102,16 @@ pn_data_t* pn_data_new(const uint8_t* src, size_t len) {
     return d;
 }
 
+pn_map_t* pn_map_new(size_t count) {
+    size_t           size = sizeof(pn_map_t) + (count * sizeof(pn_kv_pair_t));
+    pn_map_header_t* h    = pn_malloc(sizeof(pn_map_header_t) + size);
+    pn_map_t*        m    = (pn_map_t*)(h + 1);
+    h->index              = NULL;
+    m->count              = count;
+    m->size               = size;
+    return m;
+}
+
 int pn_memncmp(const void* data1, size_t size1, const void* data2, size_t size2) {
     if (size1 && size2) {
         int c = memcmp(data1, data2, (size1 < size2) ? size1 : size2);
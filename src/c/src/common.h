@@ -23,15 +23,90 @@ extern "C" {
 
 #define PN_CMP(x, y) (((x) < (y)) ? -1 : ((x) > (y)) ? 1 : 0)
 
+// For slow paths that would otherwise be inlined into, and crowd, a hot loop.
+#if defined(_MSC_VER)
+#define PN_NOINLINE __declspec(noinline)
+#else
+#define PN_NOINLINE __attribute__((noinline))
+#endif
+
+// Allocate through the allocator set with pn_set_allocator().
+void* pn_malloc(size_t size);
+void* pn_realloc(void* ptr, size_t size);
+void  pn_free(void* ptr);
+
 pn_string_t* pn_string_new(const char* src, size_t len);
 pn_string_t* pn_string_new16(const uint16_t* src, size_t len);
 pn_string_t* pn_string_new32(const uint32_t* src, size_t len);
 pn_data_t*   pn_data_new(const uint8_t* src, size_t len);
+pn_map_t*    pn_map_new(size_t count);
+
+// Precedes each pn_map_t in memory, so that its hash index doesn't change the public layout of
+// the map. Maps are allocated with pn_map_new() or pn_arena_map(), and freed with pn_mapfree().
+typedef struct {
+    struct pn_map_index* index;
+} pn_map_header_t;
+
+static inline pn_map_header_t* pn_map_header(const pn_map_t* m) {
+    return (pn_map_header_t*)m - 1;
+}
+
+// Adds (key, x) at the end of *m, taking ownership of both. If *m already has an entry for `key`,
+// its value is replaced instead, as with pn_mapset().
+void pn_mapappend(pn_map_t** m, pn_string_t* key, pn_value_t* x);
+
+// Allocate from an arena. Sizes are exact: vectors built this way can't be extended. A null `src`
+// leaves the contents uninitialized, for the caller to fill in and possibly shorten.
+void*        pn_arena_alloc(pn_arena_t* arena, size_t size);
+pn_string_t* pn_arena_string(pn_arena_t* arena, const char* src, size_t len);
+pn_data_t*   pn_arena_data(pn_arena_t* arena, const uint8_t* src, size_t len);
+pn_array_t*  pn_arena_array(pn_arena_t* arena, size_t count);  // values uninitialized
+// Takes ownership of the keys and values in `pairs`. Later duplicate keys replace earlier ones, as
+// with pn_mapappend(); the replaced values are left in the arena.
+pn_map_t* pn_arena_map(pn_arena_t* arena, const pn_kv_pair_t* pairs, size_t count);
 
 int pn_memncmp(const void* data1, size_t size1, const void* data2, size_t size2);
 
+// Writes the canonical representation of `x` to `b`, which must have room for at least
+// PN_DTOA_SIZE bytes, and returns `b`.
+#define PN_DTOA_SIZE 40
 char* pn_dtoa(char* b, double x);
 
+// Writes the shortest digits that round-trip to `x`, which must be finite and positive, and
+// NUL-terminates them. `digits` must have room for 18 bytes. Sets `decpt` to the position of the
+// decimal point relative to the start of the digits, as dtoa() does. Returns the digit count.
+size_t pn_shortest_digits(double x, char* digits, int* decpt);
+
+// Parses the common forms of float, with at most 19 significant digits and a normal result,
+// without touching the bignum machinery. Returns false if the input needs the full pn_strtod().
+bool pn_strtod_fast(const char* data, size_t size, double* f);
+
+// Returns the high 64 bits of a * b, and stores the low 64 bits in *lo.
+static inline uint64_t pn_umul128(uint64_t a, uint64_t b, uint64_t* lo) {
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 product = (unsigned __int128)a * b;
+    *lo                       = (uint64_t)product;
+    return (uint64_t)(product >> 64);
+#else
+    uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+    uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+    uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+    uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+    *lo          = (mid << 32) | (uint32_t)ll;
+    return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+// Write the decimal representation of an integer to `b`, which must have room for at least
+// PN_ITOA_SIZE bytes, and NUL-terminate it. Returns the length, not counting the NUL.
+#define PN_ITOA_SIZE 21
+size_t pn_itoa(char* b, int64_t i);
+size_t pn_utoa(char* b, uint64_t u);
+
+// Write the lowercase hex digits of `size` bytes from `data` to `b`, separating each `group` bytes
+// with a space, or not at all if `group` is 0. Doesn't NUL-terminate. Returns the length.
+size_t pn_hex(char* b, const uint8_t* data, size_t size, size_t group);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -89,6 +89,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "./common.h"
+
 #if defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
 #define DTOA_IS_SSE2_ARCH 1
 #include <immintrin.h>
@@ -1475,7 +1477,9 @@ static double pn_strtod3(string_view s00, pn_error_code_t* error) {
     *error         = PN_OK;
     U           rv = {.d = 0.0};
     string_view s  = s00;
-    if (!s.size) {
+    if (pn_strtod_fast(s.data, s.size, &rv.d)) {
+        return rv.d;
+    } else if (!s.size) {
         // ERROR: empty input
         *error = PN_ERROR_INVALID_FLOAT;
         return 0.0;
@@ -3219,8 +3223,14 @@ ret1:
 char* pn_dtoa(char* b, double x) {
     register int   i, k;
     register char* s;
-    int            decpt, j, sign;
-    char *         b0, *s0, *se;
+    int            decpt, j;
+    char *         b0, *se;
+#ifdef PN_GAY_DTOA
+    int   sign;
+    char* s0;
+#else
+    char digits[18];
+#endif
 
     b0 = b;
     if (signbit(x)) {
@@ -3235,12 +3245,17 @@ char* pn_dtoa(char* b, double x) {
         case FP_NORMAL: break;
         case FP_SUBNORMAL: break;
     }
+#ifdef PN_GAY_DTOA
     s = s0 = dtoa_r(x, 0, 0, &decpt, &sign, &se, 0, 0);
     if (decpt == 9999) /* Infinity or Nan */ {
         while ((*b++ = *s++))
             ;
         goto done;
     }
+#else
+    s  = digits;
+    se = s + pn_shortest_digits(x, digits, &decpt);
+#endif
 
     if (decpt <= -4 || decpt > se - s + 15) {
         *b++ = *s++;
@@ -3292,7 +3307,9 @@ char* pn_dtoa(char* b, double x) {
             *b   = 0;
         }
     }
+#ifdef PN_GAY_DTOA
 done:
     freedtoa(s0);
+#endif
     return b0;
 }
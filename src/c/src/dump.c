@@ -17,7 +17,6 @@
 #include <ctype.h>
 #include <errno.h>
 #include <float.h>
-#include <inttypes.h>
 #include <math.h>
 #include <stdarg.h>
 #include <stdlib.h>
@@ -26,7 +25,29 @@
 #include "./common.h"
 #include "./io.h"
 #include "./unicode.h"
-#include "./vector.h"
+
+// How a value will be written, decided before writing so that it needn't be scanned twice.
+typedef struct {
+    bool   short_form;
+    bool   verbatim;   // short form, and a string with nothing to escape
+    bool   quote_key;  // for map pairs: the key must be written as a string
+    size_t key_width;  // for map pairs: the key's width as written
+} layout_t;
+
+// State shared by the long-form writers for one call to pn_dump().
+typedef struct {
+    int       depth;         // indentation, in tabs
+    layout_t* layouts;       // scratch for dump_long_map(); nested maps stack above their parents
+    size_t    layout_count;  // in use
+    size_t    layout_size;   // allocated
+} dump_state_t;
+
+// What scan_string() found in a string.
+enum {
+    STRING_NEWLINE     = 1 << 0,  // a '\n', which long form writes as a line break
+    STRING_UNPRINTABLE = 1 << 1,  // a character that only short form can write
+    STRING_ESCAPED     = 1 << 2,  // a character that short form must escape
+};
 
 static bool dump_null(pn_output_t* out);
 static bool dump_bool(pn_bool_t b, pn_output_t* out);
@@ -37,42 +58,50 @@ static bool should_dump_short_data(const pn_data_t* d);
 static bool dump_short_data_view(const uint8_t* data, size_t size, pn_output_t* out);
 static bool dump_short_data(const pn_data_t* d, pn_output_t* out);
 static bool dump_long_data_view(
-        const uint8_t* data, size_t size, pn_string_t** indent, pn_output_t* out);
-static bool dump_long_data(const pn_data_t* d, pn_string_t** indent, pn_output_t* out);
-static bool should_dump_short_string_view(const char* data, size_t size);
-static bool should_dump_short_string(const pn_string_t* s);
+        const uint8_t* data, size_t size, dump_state_t* st, pn_output_t* out);
+static bool dump_long_data(const pn_data_t* d, dump_state_t* st, pn_output_t* out);
+static int  scan_string(const char* data, size_t size);
+static bool should_dump_short_string_view(int scanned, size_t size);
 static bool dump_short_string_view(const char* data, size_t size, pn_output_t* out);
 static bool dump_short_string(const pn_string_t* s, pn_output_t* out);
+static bool dump_verbatim_string_view(const char* data, size_t size, pn_output_t* out);
 static bool dump_long_string_view(
-        const char* data, size_t size, pn_string_t** indent, pn_output_t* out);
-static bool dump_long_string(const pn_string_t* s, pn_string_t** indent, pn_output_t* out);
+        const char* data, size_t size, dump_state_t* st, pn_output_t* out);
+static bool dump_long_string(const pn_string_t* s, dump_state_t* st, pn_output_t* out);
 static bool should_dump_short_array(const pn_array_t* a);
 static bool dump_short_array(const pn_array_t* a, pn_output_t* out);
-static bool dump_long_array(const pn_array_t* a, pn_string_t** indent, pn_output_t* out);
+static bool dump_long_array(const pn_array_t* a, dump_state_t* st, pn_output_t* out);
 static bool should_dump_short_map(const pn_map_t* m);
 static bool dump_short_map(const pn_map_t* m, pn_output_t* out);
-static bool dump_long_map(const pn_map_t* m, pn_string_t** indent, pn_output_t* out);
+static bool dump_long_map(const pn_map_t* m, dump_state_t* st, pn_output_t* out);
 
-static void pn_indent(pn_string_t** s, int delta, char ch) {
-    if (delta < 0) {
-        (*s)->count += delta;
-    } else if (delta) {
-        size_t end = (*s)->count - 1;
-        VECTOR_EXTEND(s, delta);
-        char* dst = (*s)->values + end;
-        memset(dst, ch, delta);
-        VECTOR_LAST(*s) = '\0';
+static void plan_value(const pn_value_t* x, layout_t* l) {
+    l->verbatim = false;
+    switch (x->type) {
+        case PN_DATA: l->short_form = should_dump_short_data(x->d); break;
+        case PN_STRING: {
+            size_t size   = x->s->count - 1;
+            int    found  = scan_string(x->s->values, size);
+            l->short_form = should_dump_short_string_view(found, size);
+            l->verbatim   = l->short_form && !(found & STRING_ESCAPED);
+            break;
+        }
+        case PN_ARRAY: l->short_form = should_dump_short_array(x->a); break;
+        case PN_MAP: l->short_form = should_dump_short_map(x->m); break;
+        default: l->short_form = true; break;
     }
 }
 
-static bool should_dump_short_value(const pn_value_t* x) {
-    switch (x->type) {
-        case PN_DATA: return should_dump_short_data(x->d);
-        case PN_STRING: return should_dump_short_string(x->s);
-        case PN_ARRAY: return should_dump_short_array(x->a);
-        case PN_MAP: return should_dump_short_map(x->m);
-        default: return true;
+// Reserves `count` layouts above those in use by enclosing maps, and returns the index of the
+// first. They stay reserved until layout_count is restored.
+static size_t push_layouts(dump_state_t* st, size_t count) {
+    size_t base = st->layout_count;
+    if ((base + count) > st->layout_size) {
+        st->layout_size = 2 * (base + count);
+        st->layouts     = pn_realloc(st->layouts, st->layout_size * sizeof(layout_t));
     }
+    st->layout_count += count;
+    return base;
 }
 
 static bool dump_short_value(const pn_value_t* x, pn_output_t* out) {
@@ -89,40 +118,39 @@ static bool dump_short_value(const pn_value_t* x, pn_output_t* out) {
     }
 }
 
-static bool dump_long_value(const pn_value_t* x, pn_string_t** indent, pn_output_t* out) {
+static bool dump_long_value(const pn_value_t* x, dump_state_t* st, pn_output_t* out) {
     switch (x->type) {
         case PN_NULL: return dump_null(out);
         case PN_BOOL: return dump_bool(x->b, out);
         case PN_INT: return dump_int(x->i, out);
         case PN_FLOAT: return dump_float(x->f, out);
-        case PN_DATA: return dump_long_data(x->d, indent, out);
-        case PN_STRING: return dump_long_string(x->s, indent, out);
-        case PN_ARRAY: return dump_long_array(x->a, indent, out);
-        case PN_MAP: return dump_long_map(x->m, indent, out);
+        case PN_DATA: return dump_long_data(x->d, st, out);
+        case PN_STRING: return dump_long_string(x->s, st, out);
+        case PN_ARRAY: return dump_long_array(x->a, st, out);
+        case PN_MAP: return dump_long_map(x->m, st, out);
         default: return false;
     }
 }
 
-static bool dump_null(pn_output_t* out) { return pn_raw_write(out, "null", 4); }
+static bool dump_null(pn_output_t* out) { return pn_buffered_write(out, "null", 4); }
 
 static bool dump_bool(pn_bool_t b, pn_output_t* out) {
-    return pn_raw_write(out, b ? "true" : "false", b ? 4 : 5);
+    return pn_buffered_write(out, b ? "true" : "false", b ? 4 : 5);
 }
 
 static bool dump_int(pn_int_t i, pn_output_t* out) {
-    char      buf[32];
-    ptrdiff_t len;
-    return ((len = snprintf(buf, 32, "%" PRId64, i)) > 0) && pn_raw_write(out, buf, len);
+    char buf[PN_ITOA_SIZE];
+    return pn_buffered_write(out, buf, pn_itoa(buf, i));
 }
 
 static bool dump_float(pn_float_t f, pn_output_t* out) {
-    char repr[32];
+    char repr[PN_DTOA_SIZE];
     pn_dtoa(repr, f);
-    return pn_raw_write(out, repr, strlen(repr));
+    return pn_buffered_write(out, repr, strlen(repr));
 }
 
-static bool start_line(pn_string_t* indent, pn_output_t* out) {
-    return (pn_putc('\n', out) != EOF) && pn_raw_write(out, indent->values, indent->count - 1);
+static bool start_line(const dump_state_t* st, pn_output_t* out) {
+    return pn_buffered_putc(out, '\n') && pn_buffered_fill(out, '\t', st->depth);
 }
 
 static bool should_dump_short_data_view(size_t size) { return size <= 4; }
@@ -131,11 +159,11 @@ static bool should_dump_short_data(const pn_data_t* d) {
 }
 
 static bool dump_repeated_data(size_t size, pn_output_t* out) {
-    if (pn_putc('$', out) == EOF) {
+    if (!pn_buffered_putc(out, '$')) {
         return false;
     }
     for (size_t i = 0; i < size; ++i) {
-        if (!pn_raw_write(out, "00", 2)) {
+        if (!pn_buffered_write(out, "00", 2)) {
             return false;
         }
     }
@@ -150,15 +178,20 @@ bool dump_hex(pn_output_t* out, uint64_t x, size_t len) {
         *(--ptr) = hex_digits[0x0f & x];
         x >>= 4;
     }
-    return pn_raw_write(out, ptr, len);
+    return pn_buffered_write(out, ptr, len);
 }
 
+// Long data is written 16 bytes to a line, as "$\t0011 2233 4455 6677 8899 aabb ccdd eeff".
+#define DATA_LINE_SIZE 16
+
 static bool dump_short_data_view(const uint8_t* data, size_t size, pn_output_t* out) {
-    if (pn_putc('$', out) == EOF) {
+    if (!pn_buffered_putc(out, '$')) {
         return false;
     }
-    for (size_t i = 0; i < size; ++i) {
-        if (!dump_hex(out, data[i], 2)) {
+    char hex[DATA_LINE_SIZE * 2];
+    for (size_t i = 0; i < size; i += DATA_LINE_SIZE) {
+        size_t n = ((size - i) < DATA_LINE_SIZE) ? (size - i) : DATA_LINE_SIZE;
+        if (!pn_buffered_write(out, hex, pn_hex(hex, data + i, n, 0))) {
             return false;
         }
     }
@@ -170,55 +203,92 @@ static bool dump_short_data(const pn_data_t* d, pn_output_t* out) {
 }
 
 static bool dump_long_data_view(
-        const uint8_t* data, size_t size, pn_string_t** indent, pn_output_t* out) {
-    for (size_t i = 0; i < size; ++i) {
-        if (i == 0) {
-            pn_write(out, "S", "$\t", (size_t)2);
-        } else if ((i % 16) == 0) {
-            if (!(start_line(*indent, out) && pn_raw_write(out, "$\t", 2))) {
-                return false;
-            }
-        } else if ((i % 2) == 0) {
-            if (pn_putc(' ', out) == EOF) {
-                return false;
-            }
+        const uint8_t* data, size_t size, dump_state_t* st, pn_output_t* out) {
+    char line[2 + (DATA_LINE_SIZE * 2) + (DATA_LINE_SIZE / 2)] = "$\t";
+    for (size_t i = 0; i < size; i += DATA_LINE_SIZE) {
+        size_t n = ((size - i) < DATA_LINE_SIZE) ? (size - i) : DATA_LINE_SIZE;
+        if (i && !start_line(st, out)) {
+            return false;
         }
-        if (!dump_hex(out, data[i], 2)) {
+        if (!pn_buffered_write(out, line, 2 + pn_hex(line + 2, data + i, n, 2))) {
             return false;
         }
     }
     return true;
 }
 
-static bool dump_long_data(const pn_data_t* d, pn_string_t** indent, pn_output_t* out) {
-    return dump_long_data_view(d->values, d->count, indent, out);
+static bool dump_long_data(const pn_data_t* d, dump_state_t* st, pn_output_t* out) {
+    return dump_long_data_view(d->values, d->count, st, out);
+}
+
+static bool has_escapes(const char* data, size_t size) {
+    return memchr(data, '"', size) || memchr(data, '\\', size);
 }
 
-static bool should_dump_short_string_view(const char* data, size_t size) {
-    bool has_nl = false;
+// Stops at the first unprintable character, which settles both the form and the escaping.
+static int scan_string(const char* data, size_t size) {
+    int found = 0;
     for (size_t i = 0; i < size; i = pn_rune_next(data, size, i)) {
+        size_t ascii = pn_ascii_span(data + i, size - i);
+        if (ascii && !(found & STRING_ESCAPED) && has_escapes(data + i, ascii)) {
+            found |= STRING_ESCAPED;
+        }
+        if ((i += ascii) == size) {
+            break;
+        }
+
         uint32_t r = pn_rune(data, size, i);
         if (r == '\n') {
-            has_nl = true;
-        } else if (!pn_isprint(r)) {
-            return true;  // non-printable characters require short form
+            found |= STRING_NEWLINE | STRING_ESCAPED;
+        } else if (!pn_isprint_inline(r)) {
+            return found | STRING_UNPRINTABLE | STRING_ESCAPED;
         }
     }
-    if (has_nl) {
+    return found;
+}
+
+static bool should_dump_short_string_view(int scanned, size_t size) {
+    if (scanned & STRING_UNPRINTABLE) {
+        return true;  // non-printable characters require short form
+    } else if (scanned & STRING_NEWLINE) {
         return false;
     }
     return size <= 72;
 }
 
-static bool should_dump_short_string(const pn_string_t* s) {
-    return should_dump_short_string_view(s->values, s->count - 1);
+// Writes a run of printable ASCII, escaping only '"' and '\\'.
+static bool dump_short_ascii(const char* data, size_t size, pn_output_t* out) {
+    const char* end = data + size;
+    while (true) {
+        const char* stop = data;
+        while ((stop != end) && (*stop != '"') && (*stop != '\\')) {
+            ++stop;
+        }
+        if (!pn_buffered_write(out, data, stop - data)) {
+            return false;
+        } else if (stop == end) {
+            return true;
+        } else if (!(pn_buffered_putc(out, '\\') && pn_buffered_putc(out, *stop))) {
+            return false;
+        }
+        data = stop + 1;
+    }
 }
 
 static bool dump_short_string_view(const char* data, size_t size, pn_output_t* out) {
-    if (pn_putc('"', out) == EOF) {
+    if (!pn_buffered_putc(out, '"')) {
         return false;
     }
     for (size_t i = 0, next; i < size; i = next) {
+        size_t ascii = pn_ascii_span(data + i, size - i);
+        if (ascii) {
+            if (!dump_short_ascii(data + i, ascii, out)) {
+                return false;
+            }
+            next = i + ascii;
+            continue;
+        }
+
         next          = pn_rune_next(data, size, i);
         uint32_t    r = pn_rune(data, size, i);
         const char* literal;
@@ -231,8 +301,8 @@ static bool dump_short_string_view(const char* data, size_t size, pn_output_t* o
             case '"': literal = "\\\""; break;
             case '\\': literal = "\\\\"; break;
             default:
-                if (pn_isprint(r)) {
-                    if (!pn_raw_write(out, data + i, next - i)) {
+                if (pn_isprint_inline(r)) {
+                    if (!pn_buffered_write(out, data + i, next - i)) {
                         return false;
                     }
                 } else if (r < 0x10000) {
@@ -246,11 +316,11 @@ static bool dump_short_string_view(const char* data, size_t size, pn_output_t* o
                 }
                 continue;
         }
-        if (!pn_raw_write(out, literal, strlen(literal))) {
+        if (!pn_buffered_write(out, literal, strlen(literal))) {
             return false;
         }
     }
-    if (pn_putc('"', out) == EOF) {
+    if (!pn_buffered_putc(out, '"')) {
         return false;
     }
     return true;
@@ -260,11 +330,25 @@ static bool dump_short_string(const pn_string_t* s, pn_output_t* out) {
     return dump_short_string_view(s->values, s->count - 1, out);
 }
 
+static bool dump_verbatim_string_view(const char* data, size_t size, pn_output_t* out) {
+    return pn_buffered_putc(out, '"') && pn_buffered_write(out, data, size) &&
+           pn_buffered_putc(out, '"');
+}
+
 static size_t short_string_width(const pn_string_t* s) {
     size_t      width = 2;  // ""
     const char* data  = s->values;
     size_t      size  = s->count - 1;
     for (size_t i = 0, next; i < size; i = next) {
+        size_t ascii = pn_ascii_span(data + i, size - i);
+        if (ascii) {
+            width += ascii;
+            for (next = i + ascii; i < next; ++i) {
+                width += (data[i] == '"') || (data[i] == '\\');
+            }
+            continue;
+        }
+
         next       = pn_rune_next(data, size, i);
         uint32_t r = pn_rune(data, size, i);
         switch (r) {
@@ -276,8 +360,8 @@ static size_t short_string_width(const pn_string_t* s) {
             case '"':
             case '\\': width += 2; break;
             default:
-                if (pn_isprint(r)) {
-                    width += pn_rune_width(r);
+                if (pn_isprint_inline(r)) {
+                    width += pn_rune_width_inline(r);
                 } else if (r < 0x10000) {
                     width += 6;
                 } else {
@@ -296,8 +380,7 @@ static bool split_line(const char* data, size_t size, size_t* part) {
     const char* space = NULL;
     size_t      width = 0;
     for (size_t i = 0; i < size; i = pn_rune_next(data, size, i)) {
-        uint32_t rune = pn_rune(data, size, i);
-        width += pn_rune_width(rune);
+        width += ((uint8_t)data[i] < 0x80) ? 1 : pn_rune_width_inline(pn_rune(data, size, i));
         if ((width > 72) && (i == size - 1)) {
             if (space) {
                 *part = space - data;
@@ -321,45 +404,45 @@ static bool split_line(const char* data, size_t size, size_t* part) {
 }
 
 static bool dump_long_string_view(
-        const char* data, size_t size, pn_string_t** indent, pn_output_t* out) {
+        const char* data, size_t size, dump_state_t* st, pn_output_t* out) {
     const char* const begin      = data;
     bool              can_use_gt = true;
     ++size;
     while (true) {
         size_t line_size = strcspn(data, "\n");
         if (data != begin) {
-            if (!start_line(*indent, out)) {
+            if (!start_line(st, out)) {
                 return false;
             }
         }
         if (can_use_gt || (line_size == 0)) {
-            if (pn_putc('>', out) == EOF) {
+            if (!pn_buffered_putc(out, '>')) {
                 return false;
             }
         } else {
-            if (pn_putc('|', out) == EOF) {
+            if (!pn_buffered_putc(out, '|')) {
                 return false;
             }
         }
 
         if (line_size > 0) {
-            if (pn_putc('\t', out) == EOF) {
+            if (!pn_buffered_putc(out, '\t')) {
                 return false;
             }
             size_t split;
             while (split_line(data, line_size, &split)) {
-                if (!pn_raw_write(out, data, split)) {
+                if (!pn_buffered_write(out, data, split)) {
                     return false;
                 }
                 ++split;  // cover space
                 data += split;
                 size -= split;
                 line_size -= split;
-                if (!(start_line(*indent, out) && pn_raw_write(out, ">\t", 2))) {
+                if (!(start_line(st, out) && pn_buffered_write(out, ">\t", 2))) {
                     return false;
                 }
             }
-            if (!pn_raw_write(out, data, line_size)) {
+            if (!pn_buffered_write(out, data, line_size)) {
                 return false;
             }
             can_use_gt = false;
@@ -371,7 +454,7 @@ static bool dump_long_string_view(
         size -= line_size + 1;
         if (size <= 1) {
             if (size == 0) {
-                if (!(start_line(*indent, out) && (pn_putc('!', out) != EOF))) {
+                if (!(start_line(st, out) && pn_buffered_putc(out, '!'))) {
                     return false;
                 }
             }
@@ -380,8 +463,8 @@ static bool dump_long_string_view(
     }
 }
 
-static bool dump_long_string(const pn_string_t* s, pn_string_t** indent, pn_output_t* out) {
-    return dump_long_string_view(s->values, s->count - 1, indent, out);
+static bool dump_long_string(const pn_string_t* s, dump_state_t* st, pn_output_t* out) {
+    return dump_long_string_view(s->values, s->count - 1, st, out);
 }
 
 static bool should_dump_short_array(const pn_array_t* a) {
@@ -394,12 +477,12 @@ static bool should_dump_short_array(const pn_array_t* a) {
 }
 
 static bool dump_short_array(const pn_array_t* a, pn_output_t* out) {
-    if (pn_putc('[', out) == EOF) {
+    if (!pn_buffered_putc(out, '[')) {
         return false;
     }
     for (const pn_value_t *x = a->values, *end = a->values + a->count; x != end; ++x) {
         if (x != a->values) {
-            if (!pn_raw_write(out, ", ", 2)) {
+            if (!pn_buffered_write(out, ", ", 2)) {
                 return false;
             }
         }
@@ -407,33 +490,37 @@ static bool dump_short_array(const pn_array_t* a, pn_output_t* out) {
             return false;
         }
     }
-    if (pn_putc(']', out) == EOF) {
+    if (!pn_buffered_putc(out, ']')) {
         return false;
     }
     return true;
 }
 
-static bool dump_long_array(const pn_array_t* a, pn_string_t** indent, pn_output_t* out) {
+static bool dump_planned_value(
+        const pn_value_t* x, const layout_t* l, dump_state_t* st, pn_output_t* out) {
+    if (l->verbatim) {
+        return dump_verbatim_string_view(x->s->values, x->s->count - 1, out);
+    } else if (l->short_form) {
+        return dump_short_value(x, out);
+    } else {
+        return dump_long_value(x, st, out);
+    }
+}
+
+static bool dump_long_array(const pn_array_t* a, dump_state_t* st, pn_output_t* out) {
     for (const pn_value_t *x = a->values, *end = a->values + a->count; x != end; ++x) {
         if (x != a->values) {
-            if (!start_line(*indent, out)) {
+            if (!start_line(st, out)) {
                 return false;
             }
         }
-        pn_indent(indent, +1, '\t');
-        if (!pn_raw_write(out, "*\t", 2)) {
+        layout_t l;
+        plan_value(x, &l);
+        ++st->depth;
+        if (!(pn_buffered_write(out, "*\t", 2) && dump_planned_value(x, &l, st, out))) {
             return false;
         }
-        if (should_dump_short_value(x)) {
-            if (!dump_short_value(x, out)) {
-                return false;
-            }
-        } else {
-            if (!dump_long_value(x, indent, out)) {
-                return false;
-            }
-        }
-        pn_indent(indent, -1, 0);
+        --st->depth;
     }
     return true;
 }
@@ -464,86 +551,78 @@ static bool needs_quotes(const pn_string_t* key) {
     return false;
 }
 
-static bool write_padding(pn_output_t* out, size_t len) {
-    for (size_t i = 0; i < len; ++i) {
-        if (!pn_raw_write(out, " ", 1)) {
-            return false;
-        }
-    }
-    return true;
-}
-
-static bool dump_key(const pn_string_t* key, int padding, pn_output_t* out) {
-    if (needs_quotes(key)) {
-        return dump_short_string(key, out) && pn_raw_write(out, ":", 1) &&
-               write_padding(out, padding);
+static bool dump_key(const pn_string_t* key, bool quote, int padding, pn_output_t* out) {
+    if (quote) {
+        return dump_short_string(key, out) && pn_buffered_putc(out, ':') &&
+               pn_buffered_fill(out, ' ', padding);
     } else {
-        return pn_raw_write(out, key->values, key->count - 1) && pn_raw_write(out, ":", 1) &&
-               write_padding(out, padding);
+        return pn_buffered_write(out, key->values, key->count - 1) &&
+               pn_buffered_putc(out, ':') && pn_buffered_fill(out, ' ', padding);
     }
 }
 
-static size_t key_width(const pn_string_t* key) {
-    if (needs_quotes(key)) {
-        return short_string_width(key);
-    } else {
-        return key->count - 1;
-    }
+static void plan_key(const pn_string_t* key, layout_t* l) {
+    l->quote_key = needs_quotes(key);
+    l->key_width = l->quote_key ? short_string_width(key) : (key->count - 1);
 }
 
 static bool dump_short_map(const pn_map_t* m, pn_output_t* out) {
-    if (pn_putc('{', out) == EOF) {
+    if (!pn_buffered_putc(out, '{')) {
         return false;
     }
     for (const pn_kv_pair_t *x = m->values, *end = m->values + m->count; x != end; ++x) {
         if (x != m->values) {
-            if (!pn_raw_write(out, ", ", 2)) {
+            if (!pn_buffered_write(out, ", ", 2)) {
                 return false;
             }
         }
-        if (!(dump_key(x->key, 1, out) && dump_short_value(&x->value, out))) {
+        if (!(dump_key(x->key, needs_quotes(x->key), 1, out) &&
+              dump_short_value(&x->value, out))) {
             return false;
         }
     }
-    if (pn_putc('}', out) == EOF) {
+    if (!pn_buffered_putc(out, '}')) {
         return false;
     }
     return true;
 }
 
-static bool dump_long_map(const pn_map_t* m, pn_string_t** indent, pn_output_t* out) {
+// Every pair is planned before any is written, since the padding depends on all of them. Nested
+// maps plan into st->layouts above this one's, so entries are re-read by index after each value.
+static bool dump_long_map(const pn_map_t* m, dump_state_t* st, pn_output_t* out) {
+    size_t base    = push_layouts(st, m->count);
     size_t padding = 0;
-    for (const pn_kv_pair_t *x = m->values, *end = m->values + m->count; x != end; ++x) {
-        if (should_dump_short_value(&x->value)) {
-            size_t width = key_width(x->key);
-            if (key_width(x->key) > padding) {
-                padding = width;
-            }
+    for (size_t i = 0; i < m->count; ++i) {
+        layout_t* l = &st->layouts[base + i];
+        plan_value(&m->values[i].value, l);
+        plan_key(m->values[i].key, l);
+        if (l->short_form && (l->key_width > padding)) {
+            padding = l->key_width;
         }
     }
     padding += 3;
 
-    for (const pn_kv_pair_t *x = m->values, *end = m->values + m->count; x != end; ++x) {
-        if (x != m->values) {
-            if (!start_line(*indent, out)) {
-                return false;
-            }
+    for (size_t i = 0; i < m->count; ++i) {
+        const pn_kv_pair_t* x = &m->values[i];
+        layout_t            l = st->layouts[base + i];
+        if (i && !start_line(st, out)) {
+            return false;
         }
-        size_t width = key_width(x->key);
-        if (should_dump_short_value(&x->value)) {
-            if (!(dump_key(x->key, padding - 1 - width, out) &&
-                  dump_short_value(&x->value, out))) {
+        if (l.short_form) {
+            if (!(dump_key(x->key, l.quote_key, padding - 1 - l.key_width, out) &&
+                  dump_planned_value(&x->value, &l, st, out))) {
                 return false;
             }
         } else {
-            pn_indent(indent, +1, '\t');
-            if (!(dump_key(x->key, 0, out) && start_line(*indent, out) &&
-                  dump_long_value(&x->value, indent, out))) {
+            ++st->depth;
+            if (!(dump_key(x->key, l.quote_key, 0, out) && start_line(st, out) &&
+                  dump_long_value(&x->value, st, out))) {
                 return false;
             }
-            pn_indent(indent, -1, 0);
+            --st->depth;
         }
     }
+    st->layout_count = base;
     return true;
 }
 
@@ -602,40 +681,44 @@ bool pn_dump(pn_output_t* out, int flags, int format, ...) {
     }
     va_end(vl);
 
-    bool result = false;
+    struct pn_output_buffer buf;
+    pn_output_t             buffered = pn_buffered_output(out, &buf);
+    out                              = &buffered;
+
+    bool         result = false;
+    dump_state_t st     = {0, NULL, 0, 0};
     if (s) {
-        if ((flags & PN_DUMP_SHORT) || should_dump_short_string_view(s, size)) {
+        if (flags & PN_DUMP_SHORT) {
             result = dump_short_string_view(s, size, out);
         } else {
-            pn_value_t indent;
-            pn_set(&indent, 's', "");
-            result = dump_long_string_view(s, size, &indent.s, out);
-            pn_clear(&indent);
+            int found = scan_string(s, size);
+            if (!should_dump_short_string_view(found, size)) {
+                result = dump_long_string_view(s, size, &st, out);
+            } else if (found & STRING_ESCAPED) {
+                result = dump_short_string_view(s, size, out);
+            } else {
+                result = dump_verbatim_string_view(s, size, out);
+            }
         }
     } else if (d) {
         if ((flags & PN_DUMP_SHORT) || should_dump_short_data_view(size)) {
             result = dump_short_data_view(d, size, out);
         } else {
-            pn_value_t indent;
-            pn_set(&indent, 's', "");
-            result = dump_long_data_view(d, size, &indent.s, out);
-            pn_clear(&indent);
+            result = dump_long_data_view(d, size, &st, out);
         }
     } else if (z) {
         result = dump_repeated_data(size, out);
+    } else if (flags & PN_DUMP_SHORT) {
+        result = dump_short_value(&x, out);
     } else {
-        if ((flags & PN_DUMP_SHORT) || should_dump_short_value(&x)) {
-            result = dump_short_value(&x, out);
-        } else {
-            pn_value_t indent;
-            pn_set(&indent, 's', "");
-            result = dump_long_value(&x, &indent.s, out);
-            pn_clear(&indent);
-        }
+        layout_t l;
+        plan_value(&x, &l);
+        result = dump_planned_value(&x, &l, &st, out);
     }
+    pn_free(st.layouts);
 
     if (result && !(flags & PN_DUMP_SHORT)) {
-        result = (pn_putc('\n', out) != EOF);
+        result = pn_buffered_putc(out, '\n');
     }
-    return result;
+    return pn_output_flush(&buf) && result;
 }
@@ -43,5 +43,6 @@ static const char* error_messages[] = {
         [PN_ERROR_INT_OVERFLOW] = "integer overflow",
         [PN_ERROR_INVALID_INT]  = "invalid integer",
         [PN_ERROR_RECURSION]    = "recursion limit exceeded",
+        [PN_ERROR_BINARY]       = "invalid binary encoding",
 };
 const char* pn_strerror(pn_error_code_t code) { return error_messages[code]; }
@@ -20,6 +20,14 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "common.h"
 #include "io.h"
 #include "unicode.h"
 
@@ -46,7 +54,7 @@ static FILE* pn_fopen_utf8_path(const char* path, const wchar_t* wmode) {
         num_utf16_code_points += encoded_size;
     }
 
-    uint16_t* utf16_path = malloc(sizeof(uint16_t) * (num_utf16_code_points + 1));
+    uint16_t* utf16_path = pn_malloc(sizeof(uint16_t) * (num_utf16_code_points + 1));
 
     scan_offset = 0;
     num_utf16_code_points = 0;
@@ -63,7 +71,7 @@ static FILE* pn_fopen_utf8_path(const char* path, const wchar_t* wmode) {
     utf16_path[num_utf16_code_points] = 0;
     
     FILE* f = _wfopen((const wchar_t*)utf16_path, wmode);
-    free(utf16_path);
+    pn_free(utf16_path);
 
     return f;
 }
@@ -110,13 +118,53 @@ pn_input_t pn_string_input(const pn_string_t* s) {
 }
 
 pn_input_t pn_view_input(const void* data, size_t size) {
-    struct pn_input_view* view = malloc(sizeof(struct pn_input_view));
+    struct pn_input_view* view = pn_malloc(sizeof(struct pn_input_view));
     view->data                 = data;
     view->size                 = size;
     pn_input_t in              = {.type = PN_INPUT_TYPE_VIEW, .view = view};
     return in;
 }
 
+pn_input_t pn_mmap_input(const char* path) {
+#ifdef _WIN32
+    return pn_path_input(path, PN_BINARY);
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return pn_file_input(NULL);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        int err = errno;
+        close(fd);
+        errno = err;
+        return pn_file_input(NULL);
+    } else if (!S_ISREG(st.st_mode)) {
+        return pn_file_input(fdopen(fd, "rb"));  // pipes, devices, &c. can't be mapped
+    }
+
+    size_t size = st.st_size;
+    void*  addr = NULL;
+    if (size) {  // mmap() rejects empty mappings
+        addr = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            return pn_file_input(fdopen(fd, "rb"));
+        }
+        madvise(addr, size, MADV_SEQUENTIAL);
+    }
+    close(fd);
+
+    struct pn_input_mmap* m = pn_malloc(sizeof(struct pn_input_mmap));
+    m->view.data            = size ? addr : "";
+    m->view.size            = size;
+    m->addr                 = addr;
+    m->size                 = size;
+    pn_input_t in           = {.type = PN_INPUT_TYPE_MMAP, .view = &m->view};
+    return in;
+#endif
+}
+
 pn_output_t pn_path_output(const char* path, pn_path_flags_t flags) {
     switch (flags) {
         case PN_TEXT: return pn_file_output(pn_fopen_utf8_path(path, PN_FOPEN_MODE("w")));
@@ -150,12 +198,25 @@ pn_output_t pn_string_output(pn_string_t** s) {
     return out;
 }
 
+static bool pn_mmap_close(struct pn_input_view* view) {
+    struct pn_input_mmap* m  = (struct pn_input_mmap*)view;
+    bool                  ok = true;
+#ifndef _WIN32
+    if (m->size) {
+        ok = !munmap(m->addr, m->size);
+    }
+#endif
+    pn_free(m);
+    return ok;
+}
+
 bool pn_input_close(pn_input_t* in) {
     switch (in->type) {
         case PN_INPUT_TYPE_INVALID: return true;
         case PN_INPUT_TYPE_C_FILE: return !fclose(in->c_file);
         case PN_INPUT_TYPE_STDIN: return !fclose(stdin);
-        case PN_INPUT_TYPE_VIEW: return free(in->view), true;
+        case PN_INPUT_TYPE_VIEW: return pn_free(in->view), true;
+        case PN_INPUT_TYPE_MMAP: return pn_mmap_close(in->view);
         default: return false;
     }
 }
@@ -165,7 +226,8 @@ bool pn_input_eof(const pn_input_t* in) {
         case PN_INPUT_TYPE_INVALID: return true;
         case PN_INPUT_TYPE_C_FILE: return feof(in->c_file);
         case PN_INPUT_TYPE_STDIN: return feof(stdin);
-        case PN_INPUT_TYPE_VIEW: return !in->view->data;
+        case PN_INPUT_TYPE_VIEW:
+        case PN_INPUT_TYPE_MMAP: return !in->view->data;
         default: return false;
     }
 }
@@ -175,7 +237,8 @@ bool pn_input_error(const pn_input_t* in) {
         case PN_INPUT_TYPE_INVALID: return true;
         case PN_INPUT_TYPE_C_FILE: return ferror(in->c_file);
         case PN_INPUT_TYPE_STDIN: return ferror(stdin);
-        case PN_INPUT_TYPE_VIEW: return false;
+        case PN_INPUT_TYPE_VIEW:
+        case PN_INPUT_TYPE_MMAP: return false;
         default: return false;
     }
 }
@@ -188,6 +251,7 @@ bool pn_output_close(pn_output_t* out) {
         case PN_OUTPUT_TYPE_STDERR: return !fclose(stderr);
         case PN_OUTPUT_TYPE_DATA: return true;
         case PN_OUTPUT_TYPE_STRING: return true;
+        case PN_OUTPUT_TYPE_BUFFER: return pn_output_flush(out->buffer);
         default: return false;
     }
 }
@@ -200,6 +264,7 @@ bool pn_output_eof(const pn_output_t* out) {
         case PN_OUTPUT_TYPE_STDERR: return feof(stderr);
         case PN_OUTPUT_TYPE_DATA: return !out->data;
         case PN_OUTPUT_TYPE_STRING: return !out->string;
+        case PN_OUTPUT_TYPE_BUFFER: return pn_output_eof(out->buffer->out);
         default: return false;
     }
 }
@@ -212,6 +277,7 @@ bool pn_output_error(const pn_output_t* out) {
         case PN_OUTPUT_TYPE_STDERR: return ferror(stderr);
         case PN_OUTPUT_TYPE_DATA: return false;
         case PN_OUTPUT_TYPE_STRING: return false;
+        case PN_OUTPUT_TYPE_BUFFER: return pn_output_error(out->buffer->out);
         default: return false;
     }
 }
@@ -14,11 +14,11 @@
 
 #include <pn/procyon.h>
 
-#include <inttypes.h>
 #include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "./common.h"
 #include "./io.h"
 #include "./unicode.h"
 
@@ -124,10 +124,14 @@ static void set_arg(char format, struct format_arg* dst, va_list* vl) {
     dst->type = format;
 }
 
+static bool print_i(pn_output_t* out, int64_t i) {
+    char buf[PN_ITOA_SIZE];
+    return pn_buffered_write(out, buf, pn_itoa(buf, i));
+}
+
 static bool print_u(pn_output_t* out, uint64_t u) {
-    char      buf[32];
-    ptrdiff_t len;
-    return ((len = snprintf(buf, 32, "%" PRIu64, u)) > 0) && pn_write(out, "S", buf, (size_t)len);
+    char buf[PN_ITOA_SIZE];
+    return pn_buffered_write(out, buf, pn_utoa(buf, u));
 }
 
 static bool print_s16(pn_output_t* out, const uint16_t* data, size_t len) {
@@ -136,13 +140,13 @@ static bool print_s16(pn_output_t* out, const uint16_t* data, size_t len) {
     for (const uint16_t* end = data + len; data != end; ++data) {
         char* rune = rune_storage;
         state      = pn_decode_utf16(state, *data, &rune);
-        if (!pn_raw_write(out, rune_storage, rune - rune_storage)) {
+        if (!pn_buffered_write(out, rune_storage, rune - rune_storage)) {
             return false;
         }
     }
     char* rune = rune_storage;
     pn_decode_utf16_done(state, &rune);
-    if (!pn_raw_write(out, rune_storage, rune - rune_storage)) {
+    if (!pn_buffered_write(out, rune_storage, rune - rune_storage)) {
         return false;
     }
     return true;
@@ -153,7 +157,7 @@ static bool print_s32(pn_output_t* out, const uint32_t* data, size_t len) {
     size_t size;
     for (const uint32_t* end = data + len; data != end; ++data) {
         pn_unichr(*data, rune, &size);
-        if (!pn_raw_write(out, rune, size)) {
+        if (!pn_buffered_write(out, rune, size)) {
             return false;
         }
     }
@@ -162,15 +166,15 @@ static bool print_s32(pn_output_t* out, const uint32_t* data, size_t len) {
 
 static bool print_arg(pn_output_t* out, const struct format_arg* arg) {
     switch (arg->type) {
-        case 'n': return pn_raw_write(out, "null", 4);
+        case 'n': return pn_buffered_write(out, "null", 4);
 
-        case '?': return pn_raw_write(out, arg->i ? "true" : "false", arg->i ? 4 : 5);
+        case '?': return pn_buffered_write(out, arg->i ? "true" : "false", arg->i ? 4 : 5);
 
-        case 'i': return pn_dump(out, PN_DUMP_SHORT, 'i', arg->i);
-        case 'I': return pn_dump(out, PN_DUMP_SHORT, 'I', arg->I);
-        case 'l': return pn_dump(out, PN_DUMP_SHORT, 'l', arg->l);
-        case 'L': return pn_dump(out, PN_DUMP_SHORT, 'L', arg->L);
-        case 'q': return pn_dump(out, PN_DUMP_SHORT, 'q', arg->q);
+        case 'i': return print_i(out, arg->i);
+        case 'I': return print_u(out, arg->I);
+        case 'l': return print_i(out, arg->l);
+        case 'L': return print_u(out, arg->L);
+        case 'q': return print_i(out, arg->q);
         case 'Q': return print_u(out, arg->Q);
         case 'p': return print_u(out, arg->p);
         case 'P': return print_u(out, arg->P);
@@ -187,12 +191,12 @@ static bool print_arg(pn_output_t* out, const struct format_arg* arg) {
         case 'x':
             if (arg->x->type == PN_STRING) {
                 size_t len = arg->x->s->count - 1;
-                return pn_raw_write(out, arg->x->s->values, len);
+                return pn_buffered_write(out, arg->x->s->values, len);
             }
             return pn_dump(out, PN_DUMP_SHORT, 'x', arg->x);
 
-        case 's': return pn_raw_write(out, arg->s, strlen(arg->s));
-        case 'S': return pn_raw_write(out, arg->ss.data8, arg->ss.size);
+        case 's': return pn_buffered_write(out, arg->s, strlen(arg->s));
+        case 'S': return pn_buffered_write(out, arg->ss.data8, arg->ss.size);
         case 'u': return print_s16(out, arg->ss.data16, arg->ss.size);
         case 'U': return print_s32(out, arg->ss.data32, arg->ss.size);
 
@@ -200,23 +204,17 @@ static bool print_arg(pn_output_t* out, const struct format_arg* arg) {
             char   data[4];
             size_t size;
             pn_ascchr(arg->i, data, &size);
-            return pn_raw_write(out, data, size);
+            return pn_buffered_write(out, data, size);
         }
 
         case 'C': {
             char   data[4];
             size_t size;
             pn_unichr(arg->L, data, &size);
-            return pn_raw_write(out, data, size);
+            return pn_buffered_write(out, data, size);
         }
 
-        case '#':
-            for (size_t i = 0; i < arg->z; ++i) {
-                if (pn_putc(0, out) == EOF) {
-                    return false;
-                }
-            }
-            return true;
+        case '#': return pn_buffered_fill(out, 0, arg->z);
     }
 
     // Should never happen: set_arg() filters out invalid codes before print_arg().
@@ -273,7 +271,7 @@ static bool format_segment(
     ++*format;
     if (**format == '{') {
         ++*format;
-        return pn_putc('{', out) != EOF;
+        return pn_buffered_putc(out, '{');
     }
 
     size_t      span       = strspn(*format, "0123456789");
@@ -321,32 +319,20 @@ static bool format_segment(
 fail:
     --*format;
     size_t len = format_end - *format;
-    if (!pn_raw_write(out, *format, len)) {
+    if (!pn_buffered_write(out, *format, len)) {
         return false;
     }
     *format = format_end;
     return true;
 }
 
-#define NSTACKARGS 8
-bool pn_format(pn_output_t* out, const char* output_format, const char* input_format, ...) {
-    struct format_arg  stack_args[NSTACKARGS];
-    struct format_arg* heap_args = NULL;
-    size_t             nargs     = strlen(input_format);
-    struct format_arg* args      = (nargs > NSTACKARGS) ? heap_args : stack_args;
-
-    va_list vl;
-    va_start(vl, input_format);
-    for (size_t i = 0; i < nargs; ++i) {
-        set_arg(input_format[i], &args[i], &vl);
-    }
-    va_end(vl);
-
+static bool format_all(
+        pn_output_t* out, const char* output_format, const struct format_arg* args, size_t nargs) {
     const struct format_arg* next_arg = nargs ? args : &null_arg;
     while (*output_format) {
         size_t span = strcspn(output_format, "{}");
         if (span) {
-            if (!pn_raw_write(out, output_format, span)) {
+            if (!pn_buffered_write(out, output_format, span)) {
                 return false;
             }
             output_format += span;
@@ -359,7 +345,7 @@ bool pn_format(pn_output_t* out, const char* output_format, const char* input_fo
                 break;
 
             case '}':
-                if (pn_putc('}', out) == EOF) {
+                if (!pn_buffered_putc(out, '}')) {
                     return false;
                 }
                 output_format += (output_format[1] == '}') ? 2 : 1;
@@ -368,3 +354,23 @@ bool pn_format(pn_output_t* out, const char* output_format, const char* input_fo
     }
     return true;
 }
+
+#define NSTACKARGS 8
+bool pn_format(pn_output_t* out, const char* output_format, const char* input_format, ...) {
+    struct format_arg  stack_args[NSTACKARGS];
+    struct format_arg* heap_args = NULL;
+    size_t             nargs     = strlen(input_format);
+    struct format_arg* args      = (nargs > NSTACKARGS) ? heap_args : stack_args;
+
+    va_list vl;
+    va_start(vl, input_format);
+    for (size_t i = 0; i < nargs; ++i) {
+        set_arg(input_format[i], &args[i], &vl);
+    }
+    va_end(vl);
+
+    struct pn_output_buffer buf;
+    pn_output_t             buffered = pn_buffered_output(out, &buf);
+    bool                    result   = format_all(&buffered, output_format, args, nargs);
+    return pn_output_flush(&buf) && result;
+}
@@ -0,0 +1,164 @@
+// Copyright 2017 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <pn/procyon.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "./common.h"
+#include "./io.h"
+
+// The document is built in memory, since a container's body is laid out before its children's,
+// which fill in its slots once their own offsets are known. Everything is addressed by offset,
+// because the buffer moves as it grows.
+typedef struct {
+    uint8_t* data;
+    size_t   count;
+    size_t   size;
+} frozen_writer_t;
+
+typedef struct {
+    const pn_string_t* key;
+    uint64_t           index;
+} frozen_key_t;
+
+// Appends `size` zeroed bytes, rounded up to keep the next body aligned, and returns their offset.
+static size_t reserve(frozen_writer_t* w, size_t size) {
+    size_t at = w->count;
+    size      = (size + 7) & ~(size_t)7;
+    if ((w->size - w->count) < size) {
+        while ((w->size - w->count) < size) {
+            w->size = w->size ? (2 * w->size) : 4096;
+        }
+        w->data = pn_realloc(w->data, w->size);
+    }
+    memset(w->data + at, 0, size);
+    w->count += size;
+    return at;
+}
+
+static void put_u64(frozen_writer_t* w, size_t at, uint64_t u) { memcpy(w->data + at, &u, 8); }
+
+static size_t freeze_bytes(frozen_writer_t* w, const void* data, size_t size, size_t extra) {
+    size_t body = reserve(w, 8 + size + extra);
+    put_u64(w, body, size);
+    memcpy(w->data + body + 8, data, size);
+    return body;
+}
+
+static int compare_keys(const void* x, const void* y) {
+    const pn_string_t* k1 = ((const frozen_key_t*)x)->key;
+    const pn_string_t* k2 = ((const frozen_key_t*)y)->key;
+    return pn_memncmp(k1->values, k1->count - 1, k2->values, k2->count - 1);
+}
+
+// Writes `x` to the slot at offset `at`.
+static void freeze(frozen_writer_t* w, size_t at, const pn_value_t* x) {
+    pn_frozen_value_t slot;
+    memset(&slot, 0, sizeof(slot));
+    slot.type = x->type;
+    switch (x->type) {
+        case PN_NULL: break;
+        case PN_BOOL: slot.b = x->b; break;
+        case PN_INT: slot.i = x->i; break;
+        case PN_FLOAT: slot.f = x->f; break;
+        case PN_DATA: slot.offset = freeze_bytes(w, x->d->values, x->d->count, 0); break;
+        case PN_STRING: slot.offset = freeze_bytes(w, x->s->values, x->s->count - 1, 1); break;
+
+        case PN_ARRAY: {
+            const pn_array_t* a = x->a;
+            slot.offset         = reserve(w, 8 + (a->count * sizeof(pn_frozen_value_t)));
+            put_u64(w, slot.offset, a->count);
+            for (size_t i = 0; i < a->count; ++i) {
+                freeze(w, slot.offset + 8 + (i * sizeof(pn_frozen_value_t)), &a->values[i]);
+            }
+            break;
+        }
+
+        case PN_MAP: {
+            const pn_map_t* m       = x->m;
+            size_t          entries = 8;
+            size_t          indexes = entries + (m->count * sizeof(pn_frozen_entry_t));
+            slot.offset             = reserve(w, indexes + (m->count * 8));
+            put_u64(w, slot.offset, m->count);
+            frozen_key_t* keys = pn_malloc((m->count + 1) * sizeof(frozen_key_t));
+            for (size_t i = 0; i < m->count; ++i) {
+                const pn_kv_pair_t* kv    = &m->values[i];
+                size_t              entry =
+                        slot.offset + entries + (i * sizeof(pn_frozen_entry_t));
+                put_u64(w, entry, freeze_bytes(w, kv->key->values, kv->key->count - 1, 1));
+                freeze(w, entry + 8, &kv->value);
+                keys[i] = (frozen_key_t){kv->key, i};
+            }
+            qsort(keys, m->count, sizeof(frozen_key_t), compare_keys);
+            for (size_t i = 0; i < m->count; ++i) {
+                put_u64(w, slot.offset + indexes + (i * 8), keys[i].index);
+            }
+            pn_free(keys);
+            break;
+        }
+    }
+    memcpy(w->data + at, &slot, sizeof(slot));
+}
+
+bool pn_dump_frozen(pn_output_t* out, const pn_value_t* x) {
+    frozen_writer_t w = {NULL, 0, 0};
+    size_t          header = reserve(&w, 8 + sizeof(pn_frozen_value_t));
+    put_u64(&w, header, PN_FROZEN_MAGIC);
+    freeze(&w, header + 8, x);
+    bool result = pn_raw_write(out, w.data, w.count);
+    pn_free(w.data);
+    return result;
+}
+
+const pn_frozen_value_t* pn_frozen_root(const void* data, size_t size) {
+    uint64_t magic;
+    if (((uintptr_t)data & 7) || (size < (8 + sizeof(pn_frozen_value_t)))) {
+        return NULL;
+    }
+    memcpy(&magic, data, 8);
+    if (magic != PN_FROZEN_MAGIC) {
+        return NULL;
+    }
+    return (const pn_frozen_value_t*)((const uint8_t*)data + 8);
+}
+
+const pn_frozen_value_t* pn_frozen_mapget(
+        const void* doc, const pn_frozen_value_t* m, const char* key, size_t size) {
+    if (m->type != PN_MAP) {
+        return NULL;
+    }
+    const uint8_t*           base    = doc;
+    const uint64_t*          body    = (const uint64_t*)(base + m->offset);
+    uint64_t                 count   = body[0];
+    const pn_frozen_entry_t* entries = (const pn_frozen_entry_t*)(body + 1);
+    const uint64_t*          indexes = (const uint64_t*)(entries + count);
+
+    uint64_t lo = 0, hi = count;
+    while (lo < hi) {
+        uint64_t                 mid   = lo + ((hi - lo) / 2);
+        const pn_frozen_entry_t* entry = &entries[indexes[mid]];
+        const uint64_t*          k     = (const uint64_t*)(base + entry->key);
+        int                      cmp   = pn_memncmp(k + 1, k[0], key, size);
+        if (cmp == 0) {
+            return &entry->value;
+        } else if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return NULL;
+}
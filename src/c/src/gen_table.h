@@ -19,5 +19,6 @@
 
 extern const uint8_t          lex_classes[256];
 extern const uint8_t* const   lex_table[];
+extern const char* const      lex_runs[];
 extern pn_parser_transition_t parse_defs[];
 extern uint8_t                parse_table[][PN_TOK_ERROR];
@@ -27,10 +27,12 @@
 #include <arpa/inet.h>
 #endif
 
+#include "./common.h"
 #include "./io.h"
 
-static bool pn_read_all_data(pn_input_t* in, pn_data_t** data);
+bool pn_read_all_data(pn_input_t* in, pn_data_t** data);
 static bool pn_read_all_str(pn_input_t* in, pn_string_t** str);
+static bool buffer_write(struct pn_output_buffer* buf, const void* data, size_t size);
 
 union pn_primitive {
     int       i;
@@ -179,12 +181,7 @@ static bool write_primitive(pn_output_t* out, size_t count, union pn_primitive*
 }
 
 static bool write_repeated(pn_output_t* out, int count) {
-    for (int i = 0; i < count; ++i) {
-        if (pn_putc(0, out) == EOF) {
-            return false;
-        }
-    }
-    return true;
+    return (count <= 0) || pn_buffered_fill(out, 0, count);
 }
 
 #define PN_WRITE_PRIMITIVE(FIELD, T, VA_T) \
@@ -263,6 +260,7 @@ int pn_getc(pn_input_t* in) {
         case PN_INPUT_TYPE_STDIN: return getc(stdin);
 
         case PN_INPUT_TYPE_VIEW:
+        case PN_INPUT_TYPE_MMAP:
             if (in->view->size == 0) {
                 in->view->data = NULL;
                 return EOF;
@@ -293,6 +291,11 @@ int pn_putc(int ch, pn_output_t* f) {
             pn_strncat(f->string, s, 1);
             return true;
         }
+
+        case PN_OUTPUT_TYPE_BUFFER: {
+            char s[] = {ch};
+            return buffer_write(f->buffer, s, 1) ? (uint8_t)ch : EOF;
+        }
         default: return EOF;
     }
 }
@@ -304,6 +307,7 @@ bool pn_raw_read(pn_input_t* in, void* data, size_t size) {
         case PN_INPUT_TYPE_STDIN: return fread(data, 1, size, stdin) == size;
 
         case PN_INPUT_TYPE_VIEW:
+        case PN_INPUT_TYPE_MMAP:
             if (in->view->size < size) {
                 in->view->size = 0;
                 in->view->data = NULL;
@@ -340,12 +344,13 @@ static bool pn_view_read_all_data(struct pn_input_view* in, pn_data_t** data) {
     return true;
 }
 
-static bool pn_read_all_data(pn_input_t* in, pn_data_t** data) {
+bool pn_read_all_data(pn_input_t* in, pn_data_t** data) {
     switch (in->type) {
         case PN_INPUT_TYPE_INVALID: return false;
         case PN_INPUT_TYPE_C_FILE: return pn_file_read_all_data(in->c_file, data);
         case PN_INPUT_TYPE_STDIN: return pn_file_read_all_data(stdin, data);
-        case PN_INPUT_TYPE_VIEW: return pn_view_read_all_data(in->view, data);
+        case PN_INPUT_TYPE_VIEW:
+        case PN_INPUT_TYPE_MMAP: return pn_view_read_all_data(in->view, data);
         default: return false;
     }
 }
@@ -379,7 +384,8 @@ static bool pn_read_all_str(pn_input_t* in, pn_string_t** str) {
         case PN_INPUT_TYPE_INVALID: return false;
         case PN_INPUT_TYPE_C_FILE: return pn_file_read_all_str(in->c_file, str);
         case PN_INPUT_TYPE_STDIN: return pn_file_read_all_str(stdin, str);
-        case PN_INPUT_TYPE_VIEW: return pn_view_read_all_str(in->view, str);
+        case PN_INPUT_TYPE_VIEW:
+        case PN_INPUT_TYPE_MMAP: return pn_view_read_all_str(in->view, str);
         default: return false;
     }
 }
@@ -392,70 +398,201 @@ bool pn_raw_write(pn_output_t* out, const void* data, size_t size) {
         case PN_OUTPUT_TYPE_STDERR: return fwrite(data, 1, size, stderr) == size;
         case PN_OUTPUT_TYPE_DATA: return pn_datacat(out->data, data, size), true;
         case PN_OUTPUT_TYPE_STRING: return pn_strncat(out->string, data, size), true;
+        case PN_OUTPUT_TYPE_BUFFER: return buffer_write(out->buffer, data, size);
         default: return false;
     }
 }
 
-ptrdiff_t pn_file_getline(FILE* f, char** data, size_t* size) {
-    if (!(data && size)) {
-        errno = EINVAL;
-        return -1;
+pn_output_t pn_buffered_output(pn_output_t* out, struct pn_output_buffer* buf) {
+    if (out->type == PN_OUTPUT_TYPE_BUFFER) {
+        buf->out = NULL;
+        return *out;
     }
+    buf->out             = out;
+    buf->count           = 0;
+    pn_output_t buffered = {.type = PN_OUTPUT_TYPE_BUFFER, .buffer = buf};
+    return buffered;
+}
 
-    int    ch;
-    size_t len = 0;
-    do {
-        ch = getc(f);
-        if (ch == EOF) {
-            if (!len) {
-                return -1;
-            }
-            break;
-        } else if (len == PTRDIFF_MAX) {
-            errno = EOVERFLOW;
-            return -1;
-        } else if (*size == 0) {
-            *size = 16;
-            *data = realloc(*data, *size);
-        } else if (*size <= len) {
-            *size = 2 * *size;
-            *data = realloc(*data, *size);
+bool pn_output_flush(struct pn_output_buffer* buf) {
+    if (!(buf->out && buf->count)) {
+        return true;
+    }
+    size_t count = buf->count;
+    buf->count   = 0;
+    return pn_raw_write(buf->out, buf->data, count);
+}
+
+// Appends to the buffer if there's room; otherwise flushes it first. Writes too large to gather
+// pass straight through.
+static bool buffer_write(struct pn_output_buffer* buf, const void* data, size_t size) {
+    if (size > (PN_OUTPUT_BUFFER_SIZE - buf->count)) {
+        if (!pn_output_flush(buf)) {
+            return false;
+        } else if (size >= PN_OUTPUT_BUFFER_SIZE) {
+            return pn_raw_write(buf->out, data, size);
         }
-        (*data)[len++] = ch;
-    } while (ch != '\n');
-    return len;
+    }
+    memcpy(buf->data + buf->count, data, size);
+    buf->count += size;
+    return true;
 }
 
-ptrdiff_t pn_getline(pn_input_t* in, char** data, size_t* size) {
+bool pn_buffered_fill(pn_output_t* out, char ch, size_t count) {
+    char chunk[64];
+    memset(chunk, ch, (count < sizeof(chunk)) ? count : sizeof(chunk));
+    while (count) {
+        size_t size = (count < sizeof(chunk)) ? count : sizeof(chunk);
+        if (!pn_buffered_write(out, chunk, size)) {
+            return false;
+        }
+        count -= size;
+    }
+    return true;
+}
+
+static FILE* input_stream(const pn_input_t* in) {
     switch (in->type) {
-        case PN_INPUT_TYPE_INVALID: return -1;
-        case PN_INPUT_TYPE_C_FILE: return pn_file_getline(in->c_file, data, size);
-        case PN_INPUT_TYPE_STDIN: return pn_file_getline(stdin, data, size);
+        case PN_INPUT_TYPE_C_FILE: return in->c_file;
+        case PN_INPUT_TYPE_STDIN: return stdin;
+        default: return NULL;
+    }
+}
 
-        case PN_INPUT_TYPE_VIEW: {
-            if (!(data && size)) {
-                in->view->data = NULL;
-                errno          = EINVAL;
-                return -1;
-            }
+// Streams that can seek are read a block at a time, and pn_line_buffer_clear() gives back what
+// was read ahead. Others, like pipes and terminals, are read a line at a time, so that each line
+// is returned as soon as it arrives and nothing past it is taken from the stream. On Windows, text
+// mode translates line endings, so the size of the read-ahead isn't an offset in the file.
+static bool can_seek_back(FILE* f) {
+#ifdef _WIN32
+    (void)f;
+    return false;
+#else
+    int  err = errno;
+    bool ok  = ftell(f) >= 0;
+    errno    = err;
+    return ok;
+#endif
+}
 
-            if (in->view->size == 0) {
-                in->view->data = NULL;
-                return -1;
-            }
+// Most lines fit in one chunk; longer ones are read a chunk at a time.
+#define PN_LINE_CHUNK_SIZE 512
+
+// Reads from `f` into `data` through the next newline, if it comes within `size` - 1 bytes, and
+// returns the number of bytes read. fgets() finds the newline in bulk, but doesn't say how much it
+// read, so `data` is filled with newlines first: the first one found is either the line's own,
+// just before the NUL that fgets() adds, or filler just after it. Either way, NUL bytes in the
+// line are counted.
+static size_t read_line_chunk(FILE* f, char* data, size_t size) {
+    if (size > PN_LINE_CHUNK_SIZE) {
+        size = PN_LINE_CHUNK_SIZE;
+    }
+    memset(data, '\n', size);
+    if (!fgets(data, size, f)) {
+        return 0;
+    }
+    const char* nl = memchr(data, '\n', size);
+    if (!nl) {
+        return size - 1;
+    } else if (((size_t)(nl + 1 - data) < size) && (nl[1] == '\0')) {
+        return nl + 1 - data;
+    }
+    return nl - 1 - data;
+}
 
-            void*  nl       = memchr(in->view->data, '\n', in->view->size);
-            size_t out_size = nl ? ((char*)nl - (char*)in->view->data + 1) : in->view->size;
-            if (*size < (out_size + 1)) {
-                *data = realloc(*data, (out_size + 1));
-                *size = (out_size + 1);
-            }
-            memmove(*data, in->view->data, out_size);
-            (*data)[out_size] = '\0';
-            in->view->data    = (char*)in->view->data + out_size;
-            in->view->size -= out_size;
-            return out_size;
+// Moves unconsumed data to the front of `buf` and reads more after it, growing the buffer first if
+// it is more than half full. Always leaves at least one spare byte after the data so that callers
+// may terminate the final line in place. Returns false at EOF or on error.
+static bool fill_line_buffer(pn_input_t* in, pn_line_buffer_t* buf) {
+    FILE* f = input_stream(in);
+    if (!f) {
+        return false;
+    } else if (!buf->size) {
+        buf->lines = !can_seek_back(f);
+    }
+    if (buf->begin) {
+        memmove(buf->data, buf->data + buf->begin, buf->end - buf->begin);
+        buf->end -= buf->begin;
+        buf->begin = 0;
+    }
+    if ((buf->size - buf->end) <= (buf->size / 2)) {
+        size_t size = buf->size ? (2 * buf->size) : 4096;
+        if (size > PTRDIFF_MAX) {
+            errno = EOVERFLOW;
+            return false;
         }
-        default: return -1;
+        buf->data = pn_realloc(buf->data, size);
+        buf->size = size;
+    }
+    char*  data = buf->data + buf->end;
+    size_t room = buf->size - buf->end - 1;
+    size_t n    = buf->lines ? read_line_chunk(f, data, room) : fread(data, 1, room, f);
+    buf->end += n;
+    return n > 0;
+}
+
+void pn_line_buffer_clear(pn_input_t* in, pn_line_buffer_t* buf) {
+    if (!buf->lines && (buf->end > buf->begin)) {
+        fseek(input_stream(in), -(long)(buf->end - buf->begin), SEEK_CUR);
     }
+    pn_free(buf->data);
+}
+
+// Lines of a view are returned in place. Only a final line without a newline is copied, so that
+// the caller has a byte after it to write to.
+static ptrdiff_t view_getline(struct pn_input_view* view, pn_line_buffer_t* buf, char** line) {
+    if (!view->data) {
+        return -1;
+    } else if (view->size == 0) {
+        view->data = NULL;
+        return -1;
+    }
+
+    size_t      len;
+    const char* nl = memchr(view->data, '\n', view->size);
+    if (nl) {
+        *line = (char*)view->data;
+        len   = nl + 1 - *line;
+    } else {
+        len = view->size;
+        if (buf->size <= len) {
+            buf->data = pn_realloc(buf->data, len + 1);
+            buf->size = len + 1;
+        }
+        memcpy(buf->data, view->data, len);
+        *line = buf->data;
+    }
+    view->data = (const char*)view->data + len;
+    view->size -= len;
+    return len;
+}
+
+ptrdiff_t pn_getline(pn_input_t* in, pn_line_buffer_t* buf, char** line) {
+    if ((in->type == PN_INPUT_TYPE_VIEW) || (in->type == PN_INPUT_TYPE_MMAP)) {
+        return view_getline(in->view, buf, line);
+    }
+
+    size_t scanned = buf->begin;
+    while (true) {
+        char* nl = (scanned < buf->end) ? memchr(buf->data + scanned, '\n', buf->end - scanned)
+                                        : NULL;
+        if (nl) {
+            *line      = buf->data + buf->begin;
+            size_t len = nl + 1 - *line;
+            buf->begin += len;
+            return len;
+        }
+        scanned = buf->end - buf->begin;
+        if (!fill_line_buffer(in, buf)) {
+            break;
+        }
+    }
+
+    size_t len = buf->end - buf->begin;
+    if (!len) {
+        return -1;
+    }
+    *line      = buf->data + buf->begin;
+    buf->begin = buf->end;
+    return len;
 }
@@ -16,6 +16,7 @@
 #define PROCYON_IO_H_
 
 #include <pn/procyon.h>
+#include <string.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -26,11 +27,83 @@ struct pn_input_view {
     size_t      size;
 };
 
+// A PN_INPUT_TYPE_MMAP input reads from `view` like a PN_INPUT_TYPE_VIEW input; `addr` and `size`
+// describe the whole mapping, for unmapping on close.
+struct pn_input_mmap {
+    struct pn_input_view view;
+    void*                addr;
+    size_t               size;
+};
+
+// Read-ahead buffer for pn_getline(). Bytes in [begin, end) of `data` have been read from the
+// input but not yet returned as lines. If `lines` is set, the input can't take back read-ahead,
+// so it is read only up to the end of each line.
+typedef struct {
+    char*  data;
+    size_t size;
+    size_t begin;
+    size_t end;
+    bool   lines;
+} pn_line_buffer_t;
+
+#define PN_OUTPUT_BUFFER_SIZE 4096
+
+// Write-combining buffer for a PN_OUTPUT_TYPE_BUFFER output. Writes are gathered in `data` and
+// passed to `out` in chunks of up to PN_OUTPUT_BUFFER_SIZE bytes.
+struct pn_output_buffer {
+    pn_output_t* out;
+    size_t       count;
+    char         data[PN_OUTPUT_BUFFER_SIZE];
+};
+
 int        pn_getc(pn_input_t* in);
 int        pn_putc(int ch, pn_output_t* out);
 bool       pn_raw_read(pn_input_t* in, void* data, size_t size);
 bool       pn_raw_write(pn_output_t* out, const void* data, size_t size);
-ptrdiff_t  pn_getline(pn_input_t* in, char** data, size_t* size);
+// Appends the rest of `in` to `*data`.
+bool       pn_read_all_data(pn_input_t* in, pn_data_t** data);
+
+// Returns the length of the next line of `in`, including its newline if it has one, and points
+// `line` at it. Lines of files are read into `buf` and stay valid until the next call; lines of
+// views point into the view itself. Either way, the byte after a final line without a newline
+// may be overwritten. Returns -1 at EOF or on error.
+ptrdiff_t  pn_getline(pn_input_t* in, pn_line_buffer_t* buf, char** line);
+// Frees `buf`. Whatever was read ahead of the last line is given back to `in`, so that it is
+// still there for the next reader.
+void       pn_line_buffer_clear(pn_input_t* in, pn_line_buffer_t* buf);
+
+// Returns an output that writes to `out` through `buf`. If `out` is already buffered, returns it
+// as-is and leaves `buf` unused. Either way, pn_output_flush(buf) must be called before `out` is
+// written to directly again.
+pn_output_t pn_buffered_output(pn_output_t* out, struct pn_output_buffer* buf);
+bool        pn_output_flush(struct pn_output_buffer* buf);
+
+// Like pn_putc() and pn_raw_write(), but inline when a buffered output has room.
+static inline bool pn_buffered_putc(pn_output_t* out, char ch) {
+    if (out->type == PN_OUTPUT_TYPE_BUFFER) {
+        struct pn_output_buffer* buf = out->buffer;
+        if (buf->count < PN_OUTPUT_BUFFER_SIZE) {
+            buf->data[buf->count++] = ch;
+            return true;
+        }
+    }
+    return pn_putc((uint8_t)ch, out) != EOF;
+}
+
+static inline bool pn_buffered_write(pn_output_t* out, const void* data, size_t size) {
+    if (out->type == PN_OUTPUT_TYPE_BUFFER) {
+        struct pn_output_buffer* buf = out->buffer;
+        if (size <= (PN_OUTPUT_BUFFER_SIZE - buf->count)) {
+            memcpy(buf->data + buf->count, data, size);
+            buf->count += size;
+            return true;
+        }
+    }
+    return pn_raw_write(out, data, size);
+}
+
+// Writes `ch` `count` times.
+bool pn_buffered_fill(pn_output_t* out, char ch, size_t count);
 
 #ifdef __cplusplus
 }  // extern "C"
@@ -17,6 +17,7 @@
 #include <assert.h>
 #include <string.h>
 
+#include "./common.h"
 #include "./gen_table.h"
 #include "./io.h"
 #include "./lex.h"
@@ -76,42 +77,94 @@ static bool update_lexer_level(pn_lexer_t* lex, pn_error_t* error) {
     return false;
 }
 
-static bool next_line(pn_lexer_t* lex, pn_error_t* error) {
+// Reads lines until one that isn't blank, and measures its indent. Returns false at the end of the
+// input, or on error.
+static bool read_line(pn_lexer_t* lex) {
     while (true) {
         if (lex->line.begin != lex->line.end) {
             ++lex->lineno;
         }
         lex->prev_width  = lex->line.end - lex->line.begin;
-        ptrdiff_t size   = pn_getline(lex->in, &lex->buffer.data, &lex->buffer.size);
-        lex->token.begin = lex->token.end = lex->line.begin = lex->line.end = lex->buffer.data;
+        char*     line   = lex->buffer.data;
+        ptrdiff_t size   = pn_getline(lex->in, &lex->buffer, &line);
+        lex->token.begin = lex->token.end = lex->line.begin = lex->line.end = line;
         if (size <= 0) {
-            if (pn_input_error(lex->in)) {
-                lexer_fail(lex, error, NULL, PN_ERROR_SYSTEM);
-                return true;
-            }
-
-            lex->indent = 0;
-            if (update_lexer_level(lex, error)) {
-                return true;
-            }
-
-            lex->token.type = PN_TOK_LINE_OUT;
-            return true;
+            return false;
         }
         lex->line.end = lex->line.begin + size;
 
         if (lex->line.end[-1] != '\n') {
-            *(lex->line.end++) = '\n';  // Overwrite \0 as we don't care about NUL-termination.
+            *(lex->line.end++) = '\n';  // pn_getline() leaves room after the final line.
         }
         ++lex->line.end;
 
         lex->indent = 0;
         if (pn_lexer_indent(lex)) {
-            return update_lexer_level(lex, error);
+            return true;
         }
     }
 }
 
+// Emits the LINE_OUT that closes the innermost level at the end of the input.
+static void end_input(pn_lexer_t* lex, pn_error_t* error) {
+    if (pn_input_error(lex->in)) {
+        lexer_fail(lex, error, NULL, PN_ERROR_SYSTEM);
+        return;
+    }
+
+    lex->indent = 0;
+    if (!update_lexer_level(lex, error)) {
+        lex->token.type = PN_TOK_LINE_OUT;
+    }
+}
+
+static bool next_line(pn_lexer_t* lex, pn_error_t* error) {
+    if (read_line(lex)) {
+        return update_lexer_level(lex, error);
+    }
+    end_input(lex, error);
+    return true;
+}
+
+void pn_lexer_skip(pn_lexer_t* lex, pn_error_t* error) {
+    ptrdiff_t level = VECTOR_LAST(lex->levels);
+    while (read_line(lex)) {
+        if (lex->indent < level) {
+            update_lexer_level(lex, error);
+            return;
+        }
+    }
+    lex->eq = false;
+    end_input(lex, error);
+}
+
+// Returns the end of the run starting at `p` of printable ASCII bytes other than `stops`. Checks
+// eight bytes at a time, like pn_ascii_span(), and also for each stop byte: XORing it out leaves a
+// zero byte, and subtracting 1 from that borrows from its high bit. Kept out of line so that
+// pn_lexer_next() stays tight for the many tokens that have no runs.
+PN_NOINLINE static char* skip_run(char* p, const char* end, const char* stops) {
+    const uint64_t ones  = UINT64_C(0x0101010101010101);
+    const uint64_t highs = UINT64_C(0x8080808080808080);
+    uint8_t        stop0 = stops[0];
+    uint8_t        stop1 = stop0 ? stops[1] : '\0';  // NUL is never part of a run anyway
+    for (; (end - p) >= 8; p += 8) {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        uint64_t x0    = v ^ (ones * stop0);
+        uint64_t x1    = v ^ (ones * stop1);
+        uint64_t found = ((v - (ones * ' ')) & ~v) | ((v + ones) | v) | ((x0 - ones) & ~x0) |
+                         ((x1 - ones) & ~x1);
+        if (found & highs) {
+            break;
+        }
+    }
+    while ((p < end) && ((uint8_t)(*p - ' ') < ('~' - ' ' + 1)) && (*p != stop0) &&
+           (*p != stop1)) {
+        ++p;
+    }
+    return p;
+}
+
 void pn_lexer_next(pn_lexer_t* lex, pn_error_t* error) {
     // Either initial, when the line is NULL, or final, when it is empty.
     if (lex->line.begin == lex->line.end) {
@@ -145,10 +198,20 @@ void pn_lexer_next(pn_lexer_t* lex, pn_error_t* error) {
     while (lex->token.end < lex->line.end) {
         uint8_t ch    = *lex->token.end;
         uint8_t class = lex_classes[ch];
-        if ((state = lex_table[state][class]) & PN_TOK_FLAG_DONE) {
+        uint8_t next  = lex_table[state][class];
+        if (next & PN_TOK_FLAG_DONE) {
+            state = next;
             break;
         }
         lex->token.end++;
+
+        // Some states, like the body of a comment, only leave on a few bytes. Once in one, skip
+        // past the rest of the run of bytes that would keep it there. The line ends at its
+        // newline; the byte after that is only room, and may not be readable.
+        if ((next == state) && lex_runs[state]) {
+            lex->token.end = skip_run(lex->token.end, lex->line.end - 1, lex_runs[state]);
+        }
+        state = next;
     }
 
     if (state & PN_TOK_FLAG_OK) {
@@ -178,6 +241,6 @@ void pn_lexer_init(pn_lexer_t* lex, pn_input_t* in) {
 }
 
 void pn_lexer_clear(pn_lexer_t* lex) {
-    free(lex->levels);
-    free(lex->buffer.data);
+    pn_free(lex->levels);
+    pn_line_buffer_clear(lex->in, &lex->buffer);
 }
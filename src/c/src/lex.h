@@ -20,6 +20,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "io.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif  // __cplusplus
@@ -85,10 +87,7 @@ typedef struct {
         char* end;    // data + size of current line
     } line;
 
-    struct {
-        char*  data;
-        size_t size;
-    } buffer;
+    pn_line_buffer_t buffer;
 
     struct {
         size_t  count;
@@ -101,6 +100,10 @@ void pn_lexer_init(pn_lexer_t* lex, pn_input_t* in);
 void pn_lexer_clear(pn_lexer_t* lex);
 void pn_lexer_next(pn_lexer_t* lex, pn_error_t* error);
 
+// Skips the rest of the current line, and the lines after it indented at least as far as the
+// innermost level, reading only their indentation. Emits the LINE_OUT that closes the level.
+void pn_lexer_skip(pn_lexer_t* lex, pn_error_t* error);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
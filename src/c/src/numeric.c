@@ -17,6 +17,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "./common.h"
+
 #define PN_MAX_DIGITS64 19
 #define DIGITS(SUFFIX)                                                                          \
     {                                                                                           \
@@ -99,3 +101,108 @@ bool pn_strtoll(const char* data, size_t size, int64_t* i, pn_error_code_t* erro
 
     return true;
 }
+
+static int count_digits(uint64_t u) {
+    static const uint64_t powers[] = {
+            UINT64_C(10),
+            UINT64_C(100),
+            UINT64_C(1000),
+            UINT64_C(10000),
+            UINT64_C(100000),
+            UINT64_C(1000000),
+            UINT64_C(10000000),
+            UINT64_C(100000000),
+            UINT64_C(1000000000),
+            UINT64_C(10000000000),
+            UINT64_C(100000000000),
+            UINT64_C(1000000000000),
+            UINT64_C(10000000000000),
+            UINT64_C(100000000000000),
+            UINT64_C(1000000000000000),
+            UINT64_C(10000000000000000),
+            UINT64_C(100000000000000000),
+            UINT64_C(1000000000000000000),
+            UINT64_C(10000000000000000000),
+    };
+    int n = 1;
+    while ((n < 20) && (u >= powers[n - 1])) {
+        ++n;
+    }
+    return n;
+}
+
+// Digits are written two at a time from the end, once the length is known.
+size_t pn_utoa(char* b, uint64_t u) {
+    static const char pairs[] =
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+    if (u < 10) {
+        b[0] = '0' + u;
+        b[1] = '\0';
+        return 1;
+    }
+
+    int   n = count_digits(u);
+    char* p = b + n;
+    *p      = '\0';
+    while (u >= 100) {
+        const char* pair = pairs + ((u % 100) * 2);
+        u /= 100;
+        *--p = pair[1];
+        *--p = pair[0];
+    }
+    if (u >= 10) {
+        *--p = pairs[(u * 2) + 1];
+        *--p = pairs[u * 2];
+    } else {
+        *--p = '0' + u;
+    }
+    return n;
+}
+
+size_t pn_itoa(char* b, int64_t i) {
+    if (i < 0) {
+        *b = '-';
+        return 1 + pn_utoa(b + 1, -(uint64_t)i);
+    }
+    return pn_utoa(b, i);
+}
+
+size_t pn_hex(char* b, const uint8_t* data, size_t size, size_t group) {
+    static const char pairs[] =
+            "000102030405060708090a0b0c0d0e0f"
+            "101112131415161718191a1b1c1d1e1f"
+            "202122232425262728292a2b2c2d2e2f"
+            "303132333435363738393a3b3c3d3e3f"
+            "404142434445464748494a4b4c4d4e4f"
+            "505152535455565758595a5b5c5d5e5f"
+            "606162636465666768696a6b6c6d6e6f"
+            "707172737475767778797a7b7c7d7e7f"
+            "808182838485868788898a8b8c8d8e8f"
+            "909192939495969798999a9b9c9d9e9f"
+            "a0a1a2a3a4a5a6a7a8a9aaabacadaeaf"
+            "b0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+            "c0c1c2c3c4c5c6c7c8c9cacbcccdcecf"
+            "d0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+            "e0e1e2e3e4e5e6e7e8e9eaebecedeeef"
+            "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+    char*  p     = b;
+    size_t until = group;
+    for (size_t i = 0; i < size; ++i) {
+        if (group && !until--) {
+            *(p++) = ' ';
+            until  = group - 1;
+        }
+        memcpy(p, pairs + (data[i] * 2), 2);
+        p += 2;
+    }
+    return p - b;
+}
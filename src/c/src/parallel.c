@@ -0,0 +1,192 @@
+// Copyright 2017 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <pn/procyon.h>
+
+#include <string.h>
+
+#include "./common.h"
+#include "./io.h"
+#include "./vector.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+// A chunk smaller than this isn't worth a thread.
+#define PN_PARALLEL_CHUNK_MIN (64 * 1024)
+#define PN_PARALLEL_CHUNK_MAX 64
+
+typedef struct {
+    const char* data;
+    size_t      size;
+    pn_value_t  value;
+    bool        ok;
+} pn_chunk_t;
+
+// Returns true if a line at column 0 starting with `ch` begins a top-level item: an array element
+// (`*`) or a map key. Every other line either continues the previous item, or is a comment.
+static bool begins_item(char ch) {
+    switch (ch) {
+        case '*':
+        case '"':
+        case '+':
+        case '-':
+        case '.':
+        case '/':
+        case '_': return true;
+    }
+    return (('0' <= ch) && (ch <= '9')) || (('A' <= ch) && (ch <= 'Z')) ||
+           (('a' <= ch) && (ch <= 'z'));
+}
+
+// Returns the offset of the first line at or after `offset`, which must be the start of a line,
+// that begins a top-level item, or `size` if there is none. If `blank` is true, only empty lines
+// and comments may come before it; otherwise, `size` is returned.
+static size_t next_item(const char* data, size_t size, size_t offset, bool blank) {
+    while (offset < size) {
+        char ch = data[offset];
+        if (begins_item(ch)) {
+            return offset;
+        } else if (blank && (ch != '\n') && (ch != '#')) {
+            return size;
+        }
+        const char* nl = memchr(data + offset, '\n', size - offset);
+        if (!nl) {
+            break;
+        }
+        offset = nl - data + 1;
+    }
+    return size;
+}
+
+// Splits [data, data + size) into at most `count` chunks of whole top-level items. Returns the
+// number of chunks, or 0 if the document doesn't start with a top-level item.
+static size_t split(const char* data, size_t size, size_t count, pn_chunk_t* chunks) {
+    if (next_item(data, size, 0, true) == size) {
+        return 0;
+    }
+    size_t n = 0, begin = 0;
+    for (size_t i = 1; i < count; ++i) {
+        size_t target = size / count * i;
+        if (target <= begin) {
+            continue;
+        }
+        const char* nl = memchr(data + target - 1, '\n', size - target + 1);
+        if (!nl) {
+            break;
+        }
+        size_t end = next_item(data, size, nl - data + 1, false);
+        if (end == size) {
+            break;
+        }
+        chunks[n++] = (pn_chunk_t){data + begin, end - begin, {.type = PN_NULL}, false};
+        begin       = end;
+    }
+    chunks[n++] = (pn_chunk_t){data + begin, size - begin, {.type = PN_NULL}, false};
+    return n;
+}
+
+static void* parse_chunk(void* arg) {
+    pn_chunk_t*          chunk = arg;
+    struct pn_input_view view  = {chunk->data, chunk->size};
+    pn_input_t           in    = {.type = PN_INPUT_TYPE_VIEW, .view = &view};
+    chunk->ok                  = pn_parse(&in, &chunk->value, NULL) &&
+                ((chunk->value.type == PN_ARRAY) || (chunk->value.type == PN_MAP));
+    return NULL;
+}
+
+// Moves the contents of `src` to the end of `dst`, and frees `src`.
+static void join(pn_value_t* dst, pn_value_t* src) {
+    if (dst->type == PN_ARRAY) {
+        pn_array_t* a     = src->a;
+        size_t      start = dst->a->count;
+        VECTOR_EXTEND(&dst->a, a->count);
+        memcpy(&dst->a->values[start], a->values, a->count * sizeof(pn_value_t));
+        a->count = 0;
+    } else {
+        pn_map_t* m = src->m;
+        for (size_t i = 0; i < m->count; ++i) {
+            pn_mapappend(&dst->m, m->values[i].key, &m->values[i].value);
+        }
+        m->count = 0;
+    }
+    pn_clear(src);
+}
+
+bool pn_parse_parallel(pn_input_t* in, size_t threads, pn_value_t* out, pn_error_t* error) {
+#ifdef _WIN32
+    threads = 1;
+#else
+    if (threads == 0) {
+        long n  = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (n > 0) ? n : 1;
+    }
+#endif
+    if (!(((in->type == PN_INPUT_TYPE_VIEW) || (in->type == PN_INPUT_TYPE_MMAP)) &&
+          in->view->data)) {
+        return pn_parse(in, out, error);
+    }
+
+    const char* data  = in->view->data;
+    size_t      size  = in->view->size;
+    size_t      count = size / PN_PARALLEL_CHUNK_MIN;
+    count             = (count < threads) ? count : threads;
+    count             = (count < PN_PARALLEL_CHUNK_MAX) ? count : PN_PARALLEL_CHUNK_MAX;
+    pn_chunk_t chunks[PN_PARALLEL_CHUNK_MAX];
+    if ((count < 2) || ((count = split(data, size, count, chunks)) < 2)) {
+        return pn_parse(in, out, error);
+    }
+
+#ifndef _WIN32
+    pthread_t workers[PN_PARALLEL_CHUNK_MAX];
+    bool      started[PN_PARALLEL_CHUNK_MAX];
+    for (size_t i = 1; i < count; ++i) {
+        started[i] = (pthread_create(&workers[i], NULL, parse_chunk, &chunks[i]) == 0);
+    }
+    parse_chunk(&chunks[0]);
+    for (size_t i = 1; i < count; ++i) {
+        if (started[i]) {
+            pthread_join(workers[i], NULL);
+        } else {
+            parse_chunk(&chunks[i]);
+        }
+    }
+#else
+    for (size_t i = 0; i < count; ++i) {
+        parse_chunk(&chunks[i]);
+    }
+#endif
+
+    bool ok = true;
+    for (size_t i = 0; i < count; ++i) {
+        ok = ok && chunks[i].ok && (chunks[i].value.type == chunks[0].value.type);
+    }
+    if (!ok) {
+        // Let the serial parser find the error, so that it's reported exactly as pn_parse() would.
+        for (size_t i = 0; i < count; ++i) {
+            pn_clear(&chunks[i].value);
+        }
+        return pn_parse(in, out, error);
+    }
+
+    for (size_t i = 1; i < count; ++i) {
+        join(&chunks[0].value, &chunks[i].value);
+    }
+    pn_set(out, 'X', &chunks[0].value);
+    in->view->data = NULL;
+    in->view->size = 0;
+    return true;
+}
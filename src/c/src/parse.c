@@ -49,6 +49,15 @@ static bool parser_fail(const pn_parser_t* p, pn_error_t* error, pn_error_code_t
     return false;
 }
 
+// Values decoded into an arena belong to it, so they are dropped rather than freed.
+static void clear_value(const pn_parser_t* p, pn_value_t* x) {
+    if (p->arena) {
+        x->type = PN_NULL;
+    } else {
+        pn_clear(x);
+    }
+}
+
 bool pn_parse_int(pn_parser_t* p, pn_error_t* error) {
     int64_t         i;
     pn_error_code_t code;
@@ -70,29 +79,90 @@ bool pn_parse_float(pn_parser_t* p, pn_error_t* error) {
     return true;
 }
 
-static void parse_data_value(pn_data_t** d, const pn_lexer_t* lex) {
-    for (const char *ch = lex->token.begin + 1, *end = lex->token.end; ch != end; ++ch) {
+static uint64_t load64(const char* p) {
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; --i) {
+        v = (v << 8) | (uint8_t)p[i];
+    }
+    return v;
+}
+
+// The lexer only passes hex digits, spaces, and tabs; of those, only spaces and tabs are < '0'.
+static bool has_space(uint64_t chars, uint64_t mask) {
+    return ((chars - UINT64_C(0x3030303030303030)) & UINT64_C(0x8080808080808080) & mask) != 0;
+}
+
+// Decodes the 2n hex digits in the low 2n bytes of `chars` into n bytes of `out`, for n <= 4.
+static void decode_hex_word(uint64_t chars, uint8_t* out, int n) {
+    uint64_t letters = (chars >> 6) & UINT64_C(0x0101010101010101);
+    uint64_t nibbles = (chars & UINT64_C(0x0f0f0f0f0f0f0f0f)) + (9 * letters);
+    uint64_t pairs   = ((nibbles & UINT64_C(0x00ff00ff00ff00ff)) << 4) |
+                     ((nibbles >> 8) & UINT64_C(0x00ff00ff00ff00ff));
+    for (int i = 0; i < n; ++i) {
+        out[i] = pairs >> (16 * i);
+    }
+}
+
+// Decodes hex digits in [ch, end) into `out`, eight or four at a time where no space or tab
+// intervenes. Returns the number of bytes written.
+static size_t decode_hex(const char* ch, const char* end, uint8_t* out) {
+    uint8_t* begin = out;
+    while (ch != end) {
+        if ((end - ch) >= 8) {
+            uint64_t chars = load64(ch);
+            if (!has_space(chars, UINT64_MAX)) {
+                decode_hex_word(chars, out, 4);
+                ch += 8, out += 4;
+                continue;
+            } else if (!has_space(chars, UINT64_C(0xffffffff))) {
+                decode_hex_word(chars, out, 2);
+                ch += 4, out += 2;
+                continue;
+            }
+        }
         if ((*ch == ' ') || (*ch == '\t')) {
+            ++ch;
             continue;
         }
-        int     b1   = *(ch++);
-        int     b2   = *ch;
-        uint8_t byte = (hex[b1] << 4) | hex[b2];
-        pn_datacat(d, &byte, 1);
+        *(out++) = (hex[(uint8_t)ch[0]] << 4) | hex[(uint8_t)ch[1]];
+        ch += 2;
     }
+    return out - begin;
+}
+
+static void parse_data_value(pn_data_t** d, const pn_lexer_t* lex) {
+    const char* begin = lex->token.begin + 1;
+    size_t      count = (*d)->count;
+    pn_dataresize(d, count + ((lex->token.end - begin) / 2));
+    pn_dataresize(d, count + decode_hex(begin, lex->token.end, (*d)->values + count));
 }
 
 bool pn_parse_data(pn_parser_t* p, pn_error_t* error) {
     (void)error;
-    pn_set(&p->evt.x, 'x', &pn_dataempty);
-    parse_data_value(&p->evt.x.d, p->lex);
+    if (!p->arena) {
+        pn_set(&p->evt.x, 'x', &pn_dataempty);
+        parse_data_value(&p->evt.x.d, p->lex);
+        return true;
+    }
+    const char* begin = p->lex->token.begin + 1;
+    pn_data_t*  d     = pn_arena_data(p->arena, NULL, (p->lex->token.end - begin) / 2);
+    d->count          = decode_hex(begin, p->lex->token.end, d->values);
+    p->evt.x.type     = PN_DATA;
+    p->evt.x.d        = d;
     return true;
 }
 
+// In an arena, the accumulator is copied out and kept for reuse, rather than handed off.
 bool pn_flush_data(pn_parser_t* p, pn_error_t* error) {
     (void)error;
-    pn_set(&p->evt.x, 'X', &p->data_acc);
-    pn_set(&p->data_acc, 'x', &pn_dataempty);
+    if (!p->arena) {
+        pn_set(&p->evt.x, 'X', &p->data_acc);
+        pn_set(&p->data_acc, 'x', &pn_dataempty);
+        return true;
+    }
+    p->evt.x.type = PN_DATA;
+    p->evt.x.d    = pn_arena_data(p->arena, p->data_acc.d->values, p->data_acc.d->count);
+    pn_dataresize(&p->data_acc.d, 0);
     return true;
 }
 
@@ -108,62 +178,100 @@ static void parse_long_string_value(pn_string_t** s, const pn_lexer_t* lex) {
 
 bool pn_flush_string(pn_parser_t* p, pn_error_t* error) {
     (void)error;
-    pn_set(&p->evt.x, 'X', &p->string_acc);
-    pn_set(&p->string_acc, 'x', &pn_strempty);
+    if (!p->arena) {
+        pn_set(&p->evt.x, 'X', &p->string_acc);
+        pn_set(&p->string_acc, 'x', &pn_strempty);
+        return true;
+    }
+    pn_string_t* acc = p->string_acc.s;
+    p->evt.x.type    = PN_STRING;
+    p->evt.x.s       = pn_arena_string(p->arena, acc->values, acc->count - 1);
+    pn_strresize(&p->string_acc.s, 0);
+    VECTOR_LAST(p->string_acc.s) = '\0';
     return true;
 }
 
-static void parse_short_string_value(pn_string_t** s, const char* begin, const char* end) {
-    for (const char* ch = begin; ch != end; ++ch) {
-        if (*ch != '\\') {
-            pn_strncat(s, ch, 1);
-            continue;
+// Unescapes [begin, end) into `out`, which must have room for all of it, and returns the number of
+// bytes written. Unescaping never lengthens a string, and each run of unescaped bytes is copied
+// into place at once.
+static size_t unescape(char* out, const char* begin, const char* end) {
+    char* start = out;
+    for (const char* ch = begin; ch != end;) {
+        const char* esc_at = memchr(ch, '\\', end - ch);
+        if (!esc_at) {
+            memcpy(out, ch, end - ch);
+            out += end - ch;
+            break;
         }
-        uint8_t esc   = *(++ch);
+        memcpy(out, ch, esc_at - ch);
+        out += esc_at - ch;
+        ch = esc_at + 1;
+
+        uint8_t esc   = *(ch++);
         int     count = 0;
         if (esc == 'u') {
             count = 4;
         } else if (esc == 'U') {
             count = 8;
         } else {
-            pn_strncat(s, &escape[esc], 1);
+            *(out++) = escape[esc];
             continue;
         }
         uint32_t u = 0;
         for (int i = 0; i < count; ++i) {
-            uint8_t b = *(++ch);
+            uint8_t b = *(ch++);
             u         = (u << 4) | hex[b];
         }
         if (u < 0x80) {
-            char utf[] = {u};
-            pn_strncat(s, utf, 1);
+            *(out++) = u;
         } else if (u < 0x800) {
-            char utf[] = {0300 | ((u >> 6) & 0037), 0200 | (u & 0077)};
-            pn_strncat(s, utf, 2);
+            *(out++) = 0300 | ((u >> 6) & 0037);
+            *(out++) = 0200 | (u & 0077);
         } else if (u < 0x10000) {
-            char utf[] = {0340 | ((u >> 12) & 0017), 0200 | ((u >> 6) & 0077), 0200 | (u & 0077)};
-            pn_strncat(s, utf, 3);
+            *(out++) = 0340 | ((u >> 12) & 0017);
+            *(out++) = 0200 | ((u >> 6) & 0077);
+            *(out++) = 0200 | (u & 0077);
         } else {
-            char utf[] = {0360 | ((u >> 18) & 0x007), 0200 | ((u >> 12) & 0077),
-                          0200 | ((u >> 6) & 0077), 0200 | (u & 0077)};
-            pn_strncat(s, utf, 4);
+            *(out++) = 0360 | ((u >> 18) & 0x007);
+            *(out++) = 0200 | ((u >> 12) & 0077);
+            *(out++) = 0200 | ((u >> 6) & 0077);
+            *(out++) = 0200 | (u & 0077);
         }
     }
+    return out - start;
+}
+
+// Sets `x` to the unescaped string in [begin, end), either newly allocated or in the arena.
+static void parse_short_string_value(
+        const pn_parser_t* p, pn_value_t* x, const char* begin, const char* end) {
+    pn_string_t* s;
+    if (p->arena) {
+        s = pn_arena_string(p->arena, NULL, end - begin);
+    } else {
+        VECTOR_INIT(&s, (end - begin) + 1);
+    }
+    s->count       = unescape(s->values, begin, end) + 1;
+    VECTOR_LAST(s) = '\0';
+    x->type        = PN_STRING;
+    x->s           = s;
 }
 
 bool pn_parse_short_string(pn_parser_t* p, pn_error_t* error) {
     (void)error;
-    pn_set(&p->evt.x, 'x', &pn_strempty);
-    parse_short_string_value(&p->evt.x.s, p->lex->token.begin + 1, p->lex->token.end - 1);
+    parse_short_string_value(p, &p->evt.x, p->lex->token.begin + 1, p->lex->token.end - 1);
     return true;
 }
 
 static void parse_key(pn_parser_t* p, pn_parser_key_t key) {
+    const char* begin = p->lex->token.begin;
+    size_t      len   = p->lex->token.end - p->lex->token.begin - 1;
     if (key == PN_PRS_KEY_QUOTED) {
-        pn_set(&p->key, 'x', &pn_strempty);
-        parse_short_string_value(&p->key.s, p->lex->token.begin + 1, p->lex->token.end - 2);
+        parse_short_string_value(p, &p->key, begin + 1, begin + len - 1);
+    } else if (p->arena) {
+        p->key.type = PN_STRING;
+        p->key.s    = pn_arena_string(p->arena, begin, len);
     } else {
-        pn_set(&p->key, 'S', p->lex->token.begin, p->lex->token.end - p->lex->token.begin - 1);
+        pn_set(&p->key, 'S', begin, len);
     }
 }
 
@@ -213,7 +321,8 @@ bool pn_parse(pn_input_t* in, pn_value_t* out, pn_error_t* error) {
         if (top->type == PN_ARRAY) {
             pn_arrayext(&top->a, "X", x);
         } else if (top->type == PN_MAP) {
-            pn_mapset(&top->m, 'X', 'X', k, x);
+            pn_mapappend(&top->m, k->s, x);
+            k->type = PN_NULL;
         }
     }
 
@@ -222,24 +331,112 @@ bool pn_parse(pn_input_t* in, pn_value_t* out, pn_error_t* error) {
     return true;
 }
 
+// The parser decodes keys, strings, and data straight into the arena. Children of open containers
+// are collected in `items` until the container closes and its final size is known, then copied
+// into the arena in one piece.
+bool pn_parse_arena(pn_input_t* in, pn_arena_t* arena, pn_value_t* out, pn_error_t* error) {
+    pn_error_t ignore_error;
+    error = error ? error : &ignore_error;
+    pn_lexer_t lex;
+    pn_lexer_init(&lex, in);
+    pn_parser_t prs;
+    pn_parser_init(&prs, &lex, 64);
+    prs.arena = arena;
+
+    struct frame {
+        pn_type_t    type;
+        size_t       begin;
+        pn_string_t* key;
+    };
+    struct {
+        size_t       count;
+        size_t       size;
+        struct frame values[];
+    } * frames;
+    struct {
+        size_t       count;
+        size_t       size;
+        pn_kv_pair_t values[];
+    } * items;
+    VECTOR_INIT(&frames, 0);
+    VECTOR_INIT(&items, 0);
+
+    bool ok = true;
+    while (ok && pn_parser_next(&prs, error)) {
+        pn_kv_pair_t item = {.key = (prs.evt.k.type == PN_STRING) ? prs.evt.k.s : NULL};
+
+        switch (prs.evt.type) {
+            case PN_EVT_NULL:
+            case PN_EVT_BOOL:
+            case PN_EVT_INT:
+            case PN_EVT_FLOAT:
+            case PN_EVT_DATA:
+            case PN_EVT_STRING: item.value = prs.evt.x; break;
+
+            case PN_EVT_ARRAY_IN:
+            case PN_EVT_MAP_IN:
+                VECTOR_EXTEND(&frames, 1);
+                VECTOR_LAST(frames).type  = (prs.evt.type == PN_EVT_ARRAY_IN) ? PN_ARRAY : PN_MAP;
+                VECTOR_LAST(frames).begin = items->count;
+                VECTOR_LAST(frames).key   = item.key;
+                continue;
+
+            case PN_EVT_ARRAY_OUT:
+            case PN_EVT_MAP_OUT: {
+                struct frame        f     = VECTOR_LAST(frames);
+                const pn_kv_pair_t* begin = &items->values[f.begin];
+                size_t              count = items->count - f.begin;
+                --frames->count;
+                items->count    = f.begin;
+                item.key        = f.key;
+                item.value.type = f.type;
+                if (f.type == PN_ARRAY) {
+                    item.value.a = pn_arena_array(arena, count);
+                    for (size_t i = 0; i < count; ++i) {
+                        item.value.a->values[i] = begin[i].value;
+                    }
+                } else {
+                    item.value.m = pn_arena_map(arena, begin, count);
+                }
+                break;
+            }
+
+            default: ok = false; continue;
+        }
+
+        if (frames->count == 0) {
+            *out = item.value;
+        } else {
+            VECTOR_EXTEND(&items, 1);
+            VECTOR_LAST(items) = item;
+        }
+    }
+
+    pn_free(frames);
+    pn_free(items);
+    pn_parser_clear(&prs);
+    pn_lexer_clear(&lex);
+    return ok;
+}
+
 void pn_parser_init(pn_parser_t* p, pn_lexer_t* l, size_t stack_size) {
     pn_parser_t parser = {.lex = l};
     pn_set(&parser.data_acc, 'x', &pn_dataempty);
     pn_set(&parser.string_acc, 'x', &pn_strempty);
     parser.stack_size  = stack_size;
     parser.stack_count = 1;
-    parser.stack       = malloc(parser.stack_size);
+    parser.stack       = pn_malloc(parser.stack_size);
     parser.stack[0]    = 0;
     *p                 = parser;
 }
 
 void pn_parser_clear(pn_parser_t* p) {
-    free(p->stack);
-    pn_clear(&p->key);
+    pn_free(p->stack);
+    clear_value(p, &p->key);
     pn_clear(&p->string_acc);
     pn_clear(&p->data_acc);
-    pn_clear(&p->evt.k);
-    pn_clear(&p->evt.x);
+    clear_value(p, &p->evt.k);
+    clear_value(p, &p->evt.x);
 }
 
 static void emit(pn_parser_t* p, pn_event_type_t type, pn_event_flag_t flag) {
@@ -265,7 +462,7 @@ static void emit_fn(
 }
 
 bool pn_parser_next(pn_parser_t* p, pn_error_t* error) {
-    pn_clear(&p->evt.x);
+    clear_value(p, &p->evt.x);
     while (p->stack_count) {
         uint8_t state = p->stack[--p->stack_count];
         pn_lexer_next(p->lex, error);
@@ -316,7 +513,7 @@ bool pn_parser_next(pn_parser_t* p, pn_error_t* error) {
         }
 
         if (t->emit) {
-            pn_clear(&p->evt.k);
+            clear_value(p, &p->evt.k);
             pn_set(&p->evt.k, 'X', &p->key);
         }
         if (t->key) {
@@ -372,3 +569,134 @@ bool pn_parser_next(pn_parser_t* p, pn_error_t* error) {
     }
     return false;
 }
+
+bool pn_parser_skip_block(pn_parser_t* p, pn_error_t* error) {
+    pn_event_type_t type = (p->evt.type == PN_EVT_ARRAY_IN) ? PN_EVT_ARRAY_OUT : PN_EVT_MAP_OUT;
+    clear_value(p, &p->evt.k);
+    clear_value(p, &p->key);  // the first key of a map, already parsed
+    pn_lexer_skip(p->lex, error);
+    if (p->lex->token.type == PN_TOK_ERROR) {
+        p->evt.type = PN_EVT_ERROR;
+        return true;
+    }
+
+    // Pop the states pushed with the IN event, as BLOCK_*_LINE would on the LINE_OUT.
+    p->stack_count -= 2;
+    emit(p, type, PN_EVT_LONG);
+    return true;
+}
+
+// Returns the bracket that closes the short-form array or map whose opening bracket ends just
+// before `ch`, or NULL if it's not on the same line, or the brackets don't pair up. Brackets in
+// strings don't count; nothing else is checked.
+static char* find_short_end(char* ch, const char* end, char open) {
+    char   closers[64];
+    size_t depth     = 0;
+    closers[depth++] = (open == '[') ? ']' : '}';
+    for (; ch < end; ++ch) {
+        switch (*ch) {
+            case '\n': return NULL;
+
+            case '"':
+                for (++ch; *ch != '"'; ++ch) {
+                    if (*ch == '\n') {
+                        return NULL;
+                    } else if ((*ch == '\\') && (ch[1] != '\n')) {
+                        ++ch;
+                    }
+                }
+                break;
+
+            case '[':
+            case '{':
+                if (depth == (sizeof(closers) / sizeof(closers[0]))) {
+                    return NULL;
+                }
+                closers[depth++] = (*ch == '[') ? ']' : '}';
+                break;
+
+            case ']':
+            case '}':
+                if (*ch != closers[--depth]) {
+                    return NULL;
+                } else if (depth == 0) {
+                    return ch;
+                }
+                break;
+        }
+    }
+    return NULL;
+}
+
+bool pn_parser_skip(pn_parser_t* p, pn_error_t* error) {
+    if (!((p->evt.type == PN_EVT_ARRAY_IN) || (p->evt.type == PN_EVT_MAP_IN))) {
+        return true;
+    } else if (p->evt.flags & PN_EVT_LONG) {
+        return pn_parser_skip_block(p, error);
+    }
+
+    pn_lexer_t* lex   = p->lex;
+    char*       close = find_short_end(lex->token.end, lex->line.end, *lex->token.begin);
+    if (close) {
+        clear_value(p, &p->evt.k);
+        lex->token.type  = (*close == ']') ? PN_TOK_ARRAY_OUT : PN_TOK_MAP_OUT;
+        lex->token.begin = close;
+        lex->token.end   = close + 1;
+
+        // Pop SHORT_*_START, as the closing bracket would if it came next.
+        --p->stack_count;
+        emit(p, (*close == ']') ? PN_EVT_ARRAY_OUT : PN_EVT_MAP_OUT, PN_EVT_SHORT);
+        return true;
+    }
+
+    // The container is malformed. Parse it as usual, so the error is reported as it would be.
+    for (size_t depth = 1; depth > 0;) {
+        if (!pn_parser_next(p, error)) {
+            return false;
+        }
+        switch (p->evt.type) {
+            case PN_EVT_ARRAY_IN:
+            case PN_EVT_MAP_IN: ++depth; break;
+            case PN_EVT_ARRAY_OUT:
+            case PN_EVT_MAP_OUT: --depth; break;
+            case PN_EVT_ERROR: return true;
+            default: break;
+        }
+    }
+    return true;
+}
+
+struct pn_reader {
+    pn_lexer_t  lex;
+    pn_parser_t prs;
+};
+
+pn_reader_t* pn_reader_new(pn_input_t* in) {
+    pn_reader_t* r = pn_malloc(sizeof(pn_reader_t));
+    pn_lexer_init(&r->lex, in);
+    pn_parser_init(&r->prs, &r->lex, 64);
+    return r;
+}
+
+void pn_reader_free(pn_reader_t* r) {
+    if (!r) {
+        return;
+    }
+    pn_parser_clear(&r->prs);
+    pn_lexer_clear(&r->lex);
+    pn_free(r);
+}
+
+bool pn_reader_next(pn_reader_t* r, pn_error_t* error) {
+    pn_error_t ignore_error;
+    error = error ? error : &ignore_error;
+    return pn_parser_next(&r->prs, error) && (r->prs.evt.type != PN_EVT_ERROR);
+}
+
+bool pn_reader_skip(pn_reader_t* r, pn_error_t* error) {
+    pn_error_t ignore_error;
+    error = error ? error : &ignore_error;
+    return pn_parser_skip(&r->prs, error) && (r->prs.evt.type != PN_EVT_ERROR);
+}
+
+const pn_event_t* pn_reader_event(const pn_reader_t* r) { return &r->prs.evt; }
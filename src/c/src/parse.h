@@ -21,32 +21,6 @@
 extern "C" {
 #endif  // __cplusplus
 
-typedef enum {
-    PN_EVT_NULL = 0,
-    PN_EVT_BOOL,
-    PN_EVT_INT,
-    PN_EVT_FLOAT,
-    PN_EVT_DATA,
-    PN_EVT_STRING,
-    PN_EVT_ARRAY_IN,
-    PN_EVT_ARRAY_OUT,
-    PN_EVT_MAP_IN,
-    PN_EVT_MAP_OUT,
-    PN_EVT_ERROR,
-} pn_event_type_t;
-
-typedef enum {
-    PN_EVT_SHORT = 1 << 0,
-    PN_EVT_LONG  = 1 << 1,
-} pn_event_flag_t;
-
-typedef struct {
-    pn_event_type_t type;
-    uint8_t         flags;
-    pn_value_t      k;
-    pn_value_t      x;
-} pn_event_t;
-
 typedef struct {
     pn_event_t evt;
 
@@ -58,6 +32,10 @@ typedef struct {
     size_t   stack_count;
     size_t   stack_size;
     uint8_t* stack;
+
+    // If set, strings, data, and keys are decoded into the arena, which owns them; events then
+    // borrow them rather than owning them. Set by pn_parse_arena().
+    pn_arena_t* arena;
 } pn_parser_t;
 
 typedef bool (*pn_parser_fn_t)(pn_parser_t* p, pn_error_t* error);
@@ -116,6 +94,14 @@ void pn_parser_init(pn_parser_t* p, pn_lexer_t* l, size_t stack_size);
 void pn_parser_clear(pn_parser_t* p);
 bool pn_parser_next(pn_parser_t* p, pn_error_t* error);
 
+// Skips the rest of the array or map entered by the last event, which must have been a long-form
+// ARRAY_IN or MAP_IN, and emits its ARRAY_OUT or MAP_OUT. The skipped lines are only scanned for
+// their indentation (see pn_lexer_skip()), so errors in them go unreported.
+bool pn_parser_skip_block(pn_parser_t* p, pn_error_t* error);
+// Skips the rest of the array or map entered by the last event, if it was ARRAY_IN or MAP_IN, as
+// with pn_parser_skip_block(). A short-form array or map is skipped by matching its brackets.
+bool pn_parser_skip(pn_parser_t* p, pn_error_t* error);
+
 bool pn_parse_int(pn_parser_t* p, pn_error_t* error);
 bool pn_parse_float(pn_parser_t* p, pn_error_t* error);
 bool pn_parse_data(pn_parser_t* p, pn_error_t* error);
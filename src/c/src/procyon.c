@@ -45,12 +45,16 @@ static const union {
     pn_string_t string;
 } string_empty                      = {{1, sizeof(string_empty), ""}};
 static const pn_array_t array_empty = {0, sizeof(array_empty)};
-static const pn_map_t   map_empty   = {0, sizeof(map_empty)};
+static const struct {
+    pn_map_header_t header;
+    size_t          count;
+    size_t          size;
+} map_empty = {{NULL}, 0, sizeof(pn_map_t)};
 
 const pn_value_t pn_dataempty  = {.type = PN_DATA, .d = (pn_data_t*)&data_empty};
 const pn_value_t pn_strempty   = {.type = PN_STRING, .s = (pn_string_t*)&string_empty.string};
 const pn_value_t pn_arrayempty = {.type = PN_ARRAY, .a = (pn_array_t*)&array_empty};
-const pn_value_t pn_mapempty   = {.type = PN_MAP, .m = (pn_map_t*)&map_empty};
+const pn_value_t pn_mapempty   = {.type = PN_MAP, .m = (pn_map_t*)&map_empty.count};
 
 static void pn_copy(pn_value_t* dst, const pn_value_t* src) {
     switch (src->type) {
@@ -212,7 +216,7 @@ void pn_setv(pn_value_t* dst, const char* format, ...) {
 
 void pn_setkv(pn_value_t* dst, const char* format, ...) {
     dst->type = PN_MAP;
-    VECTOR_INIT(&dst->m, strlen(format) / 2);
+    dst->m    = pn_map_new(strlen(format) / 2);
 
     va_list vl;
     va_start(vl, format);
@@ -238,6 +242,7 @@ void pn_setkv(pn_value_t* dst, const char* format, ...) {
         ++kv;
     }
     va_end(vl);
+    pn_mapreindex(dst->m);
 }
 
 void pn_swap(pn_value_t* x, pn_value_t* y) {
@@ -248,8 +253,8 @@ void pn_swap(pn_value_t* x, pn_value_t* y) {
 
 void pn_clear(pn_value_t* x) {
     switch (x->type) {
-        case PN_DATA: free(x->d); break;
-        case PN_STRING: free(x->s); break;
+        case PN_DATA: pn_free(x->d); break;
+        case PN_STRING: pn_free(x->s); break;
         case PN_ARRAY: pn_arrayfree(x->a); break;
         case PN_MAP: pn_mapfree(x->m); break;
         default: break;
@@ -276,7 +281,7 @@ int pn_cmp(const pn_value_t* x, const pn_value_t* y) {
 }
 
 pn_data_t* pn_datadup(const pn_data_t* d) {
-    pn_data_t* new = malloc(d->size);
+    pn_data_t* new = pn_malloc(d->size);
     memcpy(new, d, d->size);
     return new;
 }
@@ -306,7 +311,7 @@ void pn_dataresize(pn_data_t** d, size_t size) {
 }
 
 pn_string_t* pn_strdup(const pn_string_t* s) {
-    pn_string_t* new = malloc(s->size);
+    pn_string_t* new = pn_malloc(s->size);
     memcpy(new, s, s->size);
     return new;
 }
@@ -368,7 +373,7 @@ void pn_strreplace(
 }
 
 pn_array_t* pn_arraydup(const pn_array_t* a) {
-    pn_array_t* new = malloc(a->size);
+    pn_array_t* new = pn_malloc(a->size);
     new->count      = a->count;
     new->size       = a->size;
     for (size_t i = 0; i < a->count; ++i) {
@@ -384,7 +389,7 @@ void pn_arrayfree(pn_array_t* a) {
     for (size_t i = 0; i < a->count; ++i) {
         pn_clear(&a->values[i]);
     }
-    free(a);
+    pn_free(a);
 }
 
 int pn_arraycmp(const pn_array_t* l1, const pn_array_t* l2) {
@@ -448,13 +453,12 @@ void pn_arrayresize(pn_array_t** a, size_t size) {
 }
 
 pn_map_t* pn_mapdup(const pn_map_t* m) {
-    pn_map_t* new = malloc(m->size);
-    new->count    = m->count;
-    new->size     = m->size;
+    pn_map_t* new = pn_map_new(m->count);
     for (size_t i = 0; i < m->count; ++i) {
         new->values[i].key = pn_strdup(m->values[i].key);
         pn_copy(&new->values[i].value, &m->values[i].value);
     }
+    pn_mapreindex(new);
     return new;
 }
 
@@ -463,10 +467,11 @@ void pn_mapfree(pn_map_t* m) {
         return;
     }
     for (size_t i = 0; i < m->count; ++i) {
-        free(m->values[i].key);
+        pn_free(m->values[i].key);
         pn_clear(&m->values[i].value);
     }
-    free(m);
+    pn_free(pn_map_header(m)->index);
+    pn_free(pn_map_header(m));
 }
 
 int pn_mapcmp(const pn_map_t* m1, const pn_map_t* m2) {
@@ -484,9 +489,168 @@ int pn_mapcmp(const pn_map_t* m1, const pn_map_t* m2) {
     return PN_CMP(m1->count, m2->count);
 }
 
-static bool map_find(pn_map_t* m, const char* key_data, size_t key_size, size_t* index) {
+// Maps smaller than this are searched linearly and don't carry an index.
+#define PN_MAP_INDEX_MIN 8
+
+// Marks the slot of a deleted entry. Lookups probe past it; insertions may reuse it.
+#define PN_MAP_SLOT_DELETED SIZE_MAX
+
+// Open-addressed hash table over the keys of a map. Entries stay in insertion order in `values`;
+// the index only records where each key is. It is valid while `count` matches the map's count.
+struct pn_map_index {
+    size_t count;    // number of map entries covered
+    size_t used;     // number of slots that aren't empty, including deleted ones
+    size_t mask;     // number of slots - 1 (a power of two)
+    size_t slots[];  // position in `values` + 1, PN_MAP_SLOT_DELETED, or 0 if empty
+};
+
+static size_t map_hash(const char* data, size_t size) {
+    uint64_t h = UINT64_C(14695981039346656037);  // FNV-1a
+    for (size_t i = 0; i < size; ++i) {
+        h = (h ^ (uint8_t)data[i]) * UINT64_C(1099511628211);
+    }
+    return h ^ (h >> 32);
+}
+
+static size_t map_index_slot_count(size_t count) {
+    size_t slot_count = 2 * PN_MAP_INDEX_MIN;
+    while (slot_count < (2 * count)) {
+        slot_count *= 2;
+    }
+    return slot_count;
+}
+
+// Adds entry `i` of `m`, whose key isn't in the index yet, reusing a deleted slot if it finds one.
+static void map_index_insert(struct pn_map_index* index, const pn_map_t* m, size_t i) {
+    const pn_string_t* key     = m->values[i].key;
+    size_t             slot    = map_hash(key->values, key->count - 1) & index->mask;
+    size_t*            deleted = NULL;
+    for (; index->slots[slot]; slot = (slot + 1) & index->mask) {
+        if (!deleted && (index->slots[slot] == PN_MAP_SLOT_DELETED)) {
+            deleted = &index->slots[slot];
+        }
+    }
+    if (deleted) {
+        *deleted = i + 1;
+    } else {
+        index->slots[slot] = i + 1;
+        ++index->used;
+    }
+    index->count = i + 1;
+}
+
+// Returns the slot that holds entry `i` of `m`.
+static size_t* map_index_find_slot(struct pn_map_index* index, const pn_map_t* m, size_t i) {
+    const pn_string_t* key  = m->values[i].key;
+    size_t             slot = map_hash(key->values, key->count - 1) & index->mask;
+    while (index->slots[slot] != (i + 1)) {
+        slot = (slot + 1) & index->mask;
+    }
+    return &index->slots[slot];
+}
+
+// Brings the index up to date with `m`. Entries appended since the last update are added
+// incrementally, unless that would fill more than half of the slots, counting deleted ones; then,
+// or after any other change to the map, it is rebuilt from scratch.
+static void map_index_sync(pn_map_t* m) {
+    pn_map_header_t*     h     = pn_map_header(m);
+    struct pn_map_index* index = h->index;
+    if (m->count < PN_MAP_INDEX_MIN) {
+        if (index) {
+            pn_free(index);
+            h->index = NULL;
+        }
+        return;
+    } else if (index && (index->count == m->count)) {
+        return;
+    }
+
+    size_t begin = 0;
+    if (index && (index->count < m->count) &&
+        ((2 * (index->used + (m->count - index->count))) <= (index->mask + 1))) {
+        begin = index->count;
+    } else {
+        size_t slot_count = map_index_slot_count(m->count);
+        pn_free(index);
+        index        = pn_malloc(sizeof(struct pn_map_index) + (slot_count * sizeof(size_t)));
+        index->count = 0;
+        index->used  = 0;
+        index->mask  = slot_count - 1;
+        memset(index->slots, 0, slot_count * sizeof(size_t));
+        h->index = index;
+    }
+    for (size_t i = begin; i < m->count; ++i) {
+        map_index_insert(index, m, i);
+    }
+}
+
+void pn_mapreindex(pn_map_t* m) {
+    pn_map_header_t* h = pn_map_header(m);
+    pn_free(h->index);
+    h->index = NULL;
+    map_index_sync(m);
+}
+
+// Removes entry `i` from `m`, and moves the entries after it down. An index in sync with the map
+// is updated in place: the removed entry's slot is marked deleted, and the moved entries' slots
+// are renumbered, by looking each one up if there are few, or else in one pass over the slots.
+// The entry's key and value are left to the caller.
+static void map_remove(pn_map_t* m, size_t i) {
+    struct pn_map_index* index = pn_map_header(m)->index;
+    if (index && (index->count == m->count)) {
+        *map_index_find_slot(index, m, i) = PN_MAP_SLOT_DELETED;
+        size_t moved = m->count - (i + 1);
+        if ((moved * 32) < (index->mask + 1)) {
+            for (size_t j = i + 1; j < m->count; ++j) {
+                --*map_index_find_slot(index, m, j);
+            }
+        } else {
+            for (size_t slot = 0; slot <= index->mask; ++slot) {
+                size_t x = index->slots[slot];
+                index->slots[slot] -= (x > (i + 1)) & (x != PN_MAP_SLOT_DELETED);
+            }
+        }
+        --index->count;
+    }
+    --m->count;
+    memmove(&m->values[i], &m->values[i + 1], (m->count - i) * sizeof(pn_kv_pair_t));
+    map_index_sync(m);
+}
+
+// Adds `count` entries at the end of *m, leaving them uninitialized, and reallocates the map
+// along with its header if it needs room.
+static void map_extend(pn_map_t** m, size_t count) {
+    (*m)->count += count;
+    size_t needed = sizeof(pn_map_t) + ((*m)->count * sizeof(pn_kv_pair_t));
+    if ((*m)->size >= needed) {
+        return;
+    }
+    while ((*m)->size < needed) {
+        (*m)->size *= 2;
+    }
+    pn_map_header_t* h = pn_realloc(pn_map_header(*m), sizeof(pn_map_header_t) + (*m)->size);
+    *m                 = (pn_map_t*)(h + 1);
+}
+
+static bool map_find(const pn_map_t* m, const char* key_data, size_t key_size, size_t* index) {
+    const struct pn_map_index* ix = pn_map_header(m)->index;
+    if (ix && (ix->count == m->count)) {
+        size_t slot = map_hash(key_data, key_size) & ix->mask;
+        for (; ix->slots[slot]; slot = (slot + 1) & ix->mask) {
+            if (ix->slots[slot] == PN_MAP_SLOT_DELETED) {
+                continue;
+            }
+            const pn_kv_pair_t* item = &m->values[ix->slots[slot] - 1];
+            if (pn_memncmp(item->key->values, item->key->count - 1, key_data, key_size) == 0) {
+                *index = ix->slots[slot] - 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
     for (size_t i = 0; i < m->count; ++i) {
-        pn_kv_pair_t* item = &m->values[i];
+        const pn_kv_pair_t* item = &m->values[i];
         if (pn_memncmp(item->key->values, item->key->count - 1, key_data, key_size) == 0) {
             *index = i;
             return true;
@@ -598,6 +762,7 @@ static bool map_vfind(
 }
 
 pn_value_t* pn_mapget(pn_map_t* m, int key_format, ...) {
+    map_index_sync(m);
     va_list vl;
     va_start(vl, key_format);
     size_t      index;
@@ -622,6 +787,7 @@ const pn_value_t* pn_mapget_const(const pn_map_t* m, int key_format, ...) {
 }
 
 bool pn_mapset(pn_map_t** m, int key_format, int value_format, ...) {
+    map_index_sync(*m);
     bool    is_new = false;
     va_list vl;
     va_start(vl, value_format);
@@ -633,46 +799,97 @@ bool pn_mapset(pn_map_t** m, int key_format, int value_format, ...) {
         pn_vset(&(*m)->values[index].value, value_format, &vl);
     } else if (key) {
         is_new = true;
-        VECTOR_EXTEND(m, 1);
+        map_extend(m, 1);
         VECTOR_LAST(*m).key = key;
         pn_vset(&VECTOR_LAST(*m).value, value_format, &vl);
+        map_index_sync(*m);
     }
     va_end(vl);
     return is_new;
 }
 
+void pn_mapappend(pn_map_t** m, pn_string_t* key, pn_value_t* x) {
+    map_index_sync(*m);
+    size_t index;
+    if (map_find(*m, key->values, key->count - 1, &index)) {
+        pn_free(key);
+        pn_clear(&(*m)->values[index].value);
+        pn_move(&(*m)->values[index].value, x);
+        return;
+    }
+    map_extend(m, 1);
+    VECTOR_LAST(*m).key = key;
+    pn_move(&VECTOR_LAST(*m).value, x);
+    map_index_sync(*m);
+}
+
+pn_map_t* pn_arena_map(pn_arena_t* arena, const pn_kv_pair_t* pairs, size_t count) {
+    size_t           size = sizeof(pn_map_t) + (count * sizeof(pn_kv_pair_t));
+    pn_map_header_t* h    = pn_arena_alloc(arena, sizeof(pn_map_header_t) + size);
+    pn_map_t*        m    = (pn_map_t*)(h + 1);
+    h->index              = NULL;
+    m->count              = 0;
+    m->size               = size;
+
+    if (count >= PN_MAP_INDEX_MIN) {
+        size_t slot_count = map_index_slot_count(count);
+        size_t index_size = sizeof(struct pn_map_index) + (slot_count * sizeof(size_t));
+        h->index          = pn_arena_alloc(arena, index_size);
+        h->index->count   = 0;
+        h->index->used    = 0;
+        h->index->mask    = slot_count - 1;
+        memset(h->index->slots, 0, slot_count * sizeof(size_t));
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const pn_string_t* key = pairs[i].key;
+        size_t             index;
+        if (map_find(m, key->values, key->count - 1, &index)) {
+            m->values[index].value = pairs[i].value;
+            continue;
+        }
+        m->values[m->count++] = pairs[i];
+        if (h->index) {
+            map_index_insert(h->index, m, m->count - 1);
+        }
+    }
+
+    if (m->count < PN_MAP_INDEX_MIN) {
+        h->index = NULL;  // left in the arena
+    }
+    return m;
+}
+
 bool pn_mapdel(pn_map_t** m, int key_format, ...) {
+    map_index_sync(*m);
     va_list vl;
     va_start(vl, key_format);
-    size_t      index;
-    pn_value_t* value = NULL;
+    size_t index;
+    bool   found = false;
     if (map_vfind(m, &index, NULL, key_format, &vl)) {
-        --(*m)->count;
-        free((*m)->values[index].key);
-        value = &(*m)->values[index].value;
-        pn_clear(value);
-        for (; index < (*m)->count; ++index) {
-            (*m)->values[index] = (*m)->values[index + 1];
-        }
+        pn_kv_pair_t kv = (*m)->values[index];
+        map_remove(*m, index);
+        pn_free(kv.key);
+        pn_clear(&kv.value);
+        found = true;
     }
     va_end(vl);
-    return value;
+    return found;
 }
 
 bool pn_mappop(pn_map_t** m, pn_value_t* x, int key_format, ...) {
+    map_index_sync(*m);
     va_list vl;
     va_start(vl, key_format);
-    size_t      index;
-    pn_value_t* value = NULL;
+    size_t index;
+    bool   found = false;
     if (map_vfind(m, &index, NULL, key_format, &vl)) {
-        --(*m)->count;
-        free((*m)->values[index].key);
-        value = &(*m)->values[index].value;
-        *x    = *value;
-        for (; index < (*m)->count; ++index) {
-            (*m)->values[index] = (*m)->values[index + 1];
-        }
+        pn_kv_pair_t kv = (*m)->values[index];
+        map_remove(*m, index);
+        pn_free(kv.key);
+        *x    = kv.value;
+        found = true;
     }
     va_end(vl);
-    return value;
+    return found;
 }
@@ -29,6 +29,10 @@ uint16_t pn_decode_utf16(uint16_t state, uint16_t this_ch, char** data);
 void     pn_decode_utf16_done(uint16_t state, char** data);
 void     pn_encode_utf16(pn_rune_t r, uint16_t* data, size_t* size);
 
+// Returns the length of the run of printable ASCII (' ' through '~') that (data, size) starts
+// with. Each byte of the run is one rune, one column wide.
+size_t pn_ascii_span(const char* data, size_t size);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -17,6 +17,8 @@
 
 #include <stdlib.h>
 
+#include "common.h"
+
 #ifdef __cplusplus
 #include <type_traits>
 #define VECTOR_CAST(V, M) reinterpret_cast<typename std::remove_reference<decltype(V)>::type>(M)
@@ -28,20 +30,23 @@
     do {                                                                      \
         size_t __count = (N);                                                 \
         size_t needed  = sizeof(**(V)) + (__count * sizeof(*(*(V))->values)); \
-        *(V)           = VECTOR_CAST(*(V), malloc(needed));                   \
+        *(V)           = VECTOR_CAST(*(V), pn_malloc(needed));                \
         (*(V))->count  = __count;                                             \
         (*(V))->size   = needed;                                              \
     } while (false)
 
+// Grows the capacity geometrically, so it only reallocates when the new count doesn't fit.
 #define VECTOR_EXTEND(V, N)                                                        \
     do {                                                                           \
         size_t __count = (N);                                                      \
         (*(V))->count += __count;                                                  \
         size_t needed = sizeof(**(V)) + ((*(V))->count * sizeof(*(*(V))->values)); \
-        while ((*(V))->size < needed) {                                            \
-            (*(V))->size *= 2;                                                     \
+        if ((*(V))->size < needed) {                                               \
+            while ((*(V))->size < needed) {                                        \
+                (*(V))->size *= 2;                                                 \
+            }                                                                      \
+            *(V) = VECTOR_CAST(*(V), pn_realloc(*(V), (*(V))->size));              \
         }                                                                          \
-        *(V) = VECTOR_CAST(*(V), realloc(*(V), (*(V))->size));                     \
     } while (false)
 
 #define VECTOR_FIRST(V) ((V)->values[0])
@@ -0,0 +1,104 @@
+// Copyright 2026 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./bench.hpp"
+
+#include <stdlib.h>
+
+namespace pnbench {
+
+std::string document(shape s, int64_t count) {
+    std::string doc;
+    switch (s) {
+        case WIDE_MAP:
+            for (int64_t i = 0; i < count; ++i) {
+                doc += "key" + std::to_string(i) + ": ";
+                switch (i % 3) {
+                    case 0: doc += std::to_string(i * 7919); break;
+                    case 1: doc += std::to_string(i) + ".125"; break;
+                    case 2: doc += "\"value " + std::to_string(i) + "\""; break;
+                }
+                doc += "\n";
+            }
+            break;
+
+        case DEEP_ARRAY:
+            for (int64_t i = 0; i < count; ++i) {
+                doc += "* " + std::string(32, '[') + std::to_string(i);
+                doc += std::string(32, ']') + "\n";
+            }
+            break;
+
+        case BLOCK_STRINGS:
+            for (int64_t i = 0; i < count; ++i) {
+                doc += "key" + std::to_string(i) + ":\n";
+                doc += "  > Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do\n";
+                doc += "  > eiusmod tempor incididunt ut labore et dolore magna aliqua.\n";
+                doc += "  |\n";
+                doc += "  | \tUt enim ad minim veniam, quis nostrud exercitation ullamco.\n";
+            }
+            break;
+
+        case DATA_BLOB:
+            for (int64_t i = 0; i < count; ++i) {
+                doc += "$ 00112233 44556677 8899aabb ccddeeff";
+                doc += " 00112233 44556677 8899aabb ccddeeff\n";
+            }
+            break;
+    }
+    return doc;
+}
+
+void document_args(benchmark::internal::Benchmark* b) {
+    for (int s : {WIDE_MAP, DEEP_ARRAY, BLOCK_STRINGS, DATA_BLOB}) {
+        for (int64_t count = 64; count <= 16384; count *= 16) {
+            b->Args({s, count});
+        }
+    }
+    b->ArgNames({"shape", "count"});
+}
+
+allocation_counter::allocation_counter() : _count{0}, _previous{*pn_get_allocator()} {
+    pn_allocator_t counter = {alloc, realloc, free, this};
+    pn_set_allocator(&counter);
+}
+
+allocation_counter::~allocation_counter() { pn_set_allocator(&_previous); }
+
+void allocation_counter::report(benchmark::State& state, size_t bytes) const {
+    if (bytes) {
+        state.SetBytesProcessed(state.iterations() * bytes);
+    }
+    state.counters["allocs/op"] =
+            benchmark::Counter(_count, benchmark::Counter::kAvgIterations);
+}
+
+void* allocation_counter::alloc(void* context, size_t size) {
+    auto* self = static_cast<allocation_counter*>(context);
+    ++self->_count;
+    return self->_previous.alloc(self->_previous.context, size);
+}
+
+void* allocation_counter::realloc(void* context, void* ptr, size_t size) {
+    auto* self = static_cast<allocation_counter*>(context);
+    ++self->_count;
+    return self->_previous.realloc(self->_previous.context, ptr, size);
+}
+
+void allocation_counter::free(void* context, void* ptr) {
+    auto* self = static_cast<allocation_counter*>(context);
+    self->_previous.free(self->_previous.context, ptr);
+}
+
+}  // namespace pnbench
@@ -0,0 +1,61 @@
+// Copyright 2026 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BENCH_BENCH_HPP_
+#define BENCH_BENCH_HPP_
+
+#include <pn/procyon.h>
+
+#include <benchmark/benchmark.h>
+#include <stdint.h>
+#include <string>
+
+namespace pnbench {
+
+// Shapes of synthetic documents. Each is generated with a given number of elements.
+enum shape {
+    WIDE_MAP,       // key: value, with int, float, and string values
+    DEEP_ARRAY,     // * [[[[...]]]], nested 32 deep
+    BLOCK_STRINGS,  // key:\n  > folded\n  > text\n  |\n  | line
+    DATA_BLOB,      // $ 00112233 ...
+};
+
+std::string document(shape s, int64_t count);
+
+// Benchmarks every shape at element counts from 64 to 16384.
+void document_args(benchmark::internal::Benchmark* b);
+
+// Counts calls into the Procyon allocator while it exists.
+class allocation_counter {
+  public:
+    allocation_counter();
+    ~allocation_counter();
+    allocation_counter(const allocation_counter&) = delete;
+    allocation_counter& operator=(const allocation_counter&) = delete;
+
+    // Sets bytes/s from `bytes` per iteration (if nonzero), and allocs/op from the count so far.
+    void report(benchmark::State& state, size_t bytes) const;
+
+  private:
+    static void* alloc(void* context, size_t size);
+    static void* realloc(void* context, void* ptr, size_t size);
+    static void  free(void* context, void* ptr);
+
+    int64_t        _count;
+    pn_allocator_t _previous;
+};
+
+}  // namespace pnbench
+
+#endif  // BENCH_BENCH_HPP_
@@ -0,0 +1,52 @@
+// Copyright 2026 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <pn/procyon.h>
+
+#include <benchmark/benchmark.h>
+
+#include "./bench.hpp"
+
+namespace pnbench {
+namespace {
+
+void BM_Dump(benchmark::State& state, int flags) {
+    std::string doc = document(static_cast<shape>(state.range(0)), state.range(1));
+    pn_input_t  in  = pn_view_input(doc.data(), doc.size());
+    pn_value_t  x   = {PN_NULL};
+    pn_error_t  error;
+    if (!pn_parse(&in, &x, &error)) {
+        state.SkipWithError(pn_strerror(error.code));
+    }
+    pn_input_close(&in);
+
+    pn_value_t s;
+    pn_set(&s, 's', "");
+    size_t             size = 0;
+    allocation_counter allocs;
+    for (auto _ : state) {
+        pn_strresize(&s.s, 0);
+        pn_output_t out = pn_string_output(&s.s);
+        pn_dump(&out, flags, 'x', &x);
+        size = s.s->count - 1;
+    }
+    allocs.report(state, size);
+    pn_clear(&s);
+    pn_clear(&x);
+}
+BENCHMARK_CAPTURE(BM_Dump, long_form, PN_DUMP_DEFAULT)->Apply(document_args);
+BENCHMARK_CAPTURE(BM_Dump, short_form, PN_DUMP_SHORT)->Apply(document_args);
+
+}  // namespace
+}  // namespace pnbench
@@ -0,0 +1,80 @@
+// Copyright 2026 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <pn/procyon.h>
+
+#include <benchmark/benchmark.h>
+#include <math.h>
+#include <string>
+#include <vector>
+
+#include "../src/common.h"
+#include "./bench.hpp"
+
+namespace pnbench {
+namespace {
+
+// Doubles spread across magnitudes, from a fixed seed.
+std::vector<double> doubles() {
+    std::vector<double> result;
+    uint64_t            state = 0x9e3779b97f4a7c15;
+    for (int i = 0; i < 1024; ++i) {
+        state = (state * 6364136223846793005) + 1442695040888963407;
+        double mantissa = (state >> 11) * (1.0 / 9007199254740992.0);
+        int    exponent = static_cast<int>((state >> 3) % 40) - 20;
+        result.push_back(mantissa * pow(10.0, exponent));
+    }
+    return result;
+}
+
+void BM_Dtoa(benchmark::State& state) {
+    std::vector<double> values = doubles();
+    allocation_counter  allocs;
+    for (auto _ : state) {
+        char repr[PN_DTOA_SIZE];
+        for (double f : values) {
+            benchmark::DoNotOptimize(pn_dtoa(repr, f));
+        }
+    }
+    allocs.report(state, 0);
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_Dtoa);
+
+void BM_Strtod(benchmark::State& state) {
+    std::vector<std::string> reprs;
+    size_t                   bytes = 0;
+    for (double f : doubles()) {
+        char repr[PN_DTOA_SIZE];
+        pn_dtoa(repr, f);
+        reprs.push_back(repr);
+        bytes += reprs.back().size();
+    }
+
+    allocation_counter allocs;
+    for (auto _ : state) {
+        for (const std::string& repr : reprs) {
+            double          f;
+            pn_error_code_t error;
+            pn_strtod(repr.data(), repr.size(), &f, &error);
+            benchmark::DoNotOptimize(f);
+        }
+    }
+    allocs.report(state, bytes);
+    state.SetItemsProcessed(state.iterations() * reprs.size());
+}
+BENCHMARK(BM_Strtod);
+
+}  // namespace
+}  // namespace pnbench
@@ -0,0 +1,51 @@
+// Copyright 2026 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <pn/procyon.h>
+
+#include <benchmark/benchmark.h>
+
+#include "../src/lex.h"
+#include "./bench.hpp"
+
+namespace pnbench {
+namespace {
+
+void BM_Lex(benchmark::State& state) {
+    std::string doc = document(static_cast<shape>(state.range(0)), state.range(1));
+
+    allocation_counter allocs;
+    for (auto _ : state) {
+        pn_input_t in = pn_view_input(doc.data(), doc.size());
+        pn_lexer_t lex;
+        pn_lexer_init(&lex, &in);
+        int level = 0;
+        do {
+            pn_error_t error;
+            pn_lexer_next(&lex, &error);
+            if (lex.token.type == PN_TOK_LINE_IN) {
+                ++level;
+            } else if ((lex.token.type == PN_TOK_LINE_OUT) || (lex.token.type == PN_TOK_ERROR)) {
+                --level;
+            }
+        } while (level > 0);
+        pn_lexer_clear(&lex);
+        pn_input_close(&in);
+    }
+    allocs.report(state, doc.size());
+}
+BENCHMARK(BM_Lex)->Apply(document_args);
+
+}  // namespace
+}  // namespace pnbench
@@ -0,0 +1,62 @@
+// Copyright 2026 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <pn/procyon.h>
+
+#include <benchmark/benchmark.h>
+
+#include "./bench.hpp"
+
+namespace pnbench {
+namespace {
+
+void BM_Parse(benchmark::State& state) {
+    std::string doc = document(static_cast<shape>(state.range(0)), state.range(1));
+
+    allocation_counter allocs;
+    for (auto _ : state) {
+        pn_input_t in = pn_view_input(doc.data(), doc.size());
+        pn_value_t x  = {PN_NULL};
+        pn_error_t error;
+        if (!pn_parse(&in, &x, &error)) {
+            state.SkipWithError(pn_strerror(error.code));
+        }
+        pn_clear(&x);
+        pn_input_close(&in);
+    }
+    allocs.report(state, doc.size());
+}
+BENCHMARK(BM_Parse)->Apply(document_args);
+
+void BM_ParseArena(benchmark::State& state) {
+    std::string doc = document(static_cast<shape>(state.range(0)), state.range(1));
+
+    allocation_counter allocs;
+    for (auto _ : state) {
+        pn_input_t  in    = pn_view_input(doc.data(), doc.size());
+        pn_arena_t* arena = pn_arena_new();
+        pn_value_t  x;
+        pn_error_t  error;
+        if (!pn_parse_arena(&in, arena, &x, &error)) {
+            state.SkipWithError(pn_strerror(error.code));
+        }
+        pn_arena_free(arena);
+        pn_input_close(&in);
+    }
+    allocs.report(state, doc.size());
+}
+BENCHMARK(BM_ParseArena)->Apply(document_args);
+
+}  // namespace
+}  // namespace pnbench
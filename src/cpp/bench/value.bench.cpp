@@ -0,0 +1,68 @@
+// Copyright 2026 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <pn/procyon.h>
+
+#include <benchmark/benchmark.h>
+#include <pn/map>
+#include <pn/string>
+#include <string>
+#include <vector>
+
+#include "./bench.hpp"
+
+namespace pnbench {
+namespace {
+
+void BM_Format(benchmark::State& state) {
+    pn_value_t s;
+    pn_set(&s, 's', "");
+    size_t             size = 0;
+    allocation_counter allocs;
+    for (auto _ : state) {
+        pn_strresize(&s.s, 0);
+        pn_output_t out = pn_string_output(&s.s);
+        for (int i = 0; i < 64; ++i) {
+            pn_format(
+                    &out, "{0}: {1} {2} {3}\n", "sqdS", "key", (int64_t)i * 7919, i / 8.0,
+                    "value", (size_t)5);
+        }
+        size = s.s->count - 1;
+    }
+    allocs.report(state, size);
+    pn_clear(&s);
+}
+BENCHMARK(BM_Format);
+
+void BM_MapGet(benchmark::State& state) {
+    pn::map                  m;
+    std::vector<std::string> keys;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        keys.push_back("key" + std::to_string(i));
+        m[keys.back()] = i;
+    }
+
+    allocation_counter allocs;
+    for (auto _ : state) {
+        for (const std::string& k : keys) {
+            benchmark::DoNotOptimize(m.get(k).c_obj());
+        }
+    }
+    allocs.report(state, 0);
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_MapGet)->RangeMultiplier(8)->Range(4, 32768);
+
+}  // namespace
+}  // namespace pnbench
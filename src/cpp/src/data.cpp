@@ -38,7 +38,7 @@ string_view data_view::as_string() const {
 
 data_::data_(const_pointer data, size_type size) : _c_obj{pn_data_new(data, size)} {}
 
-data_::~data_() { free(_c_obj); }
+data_::~data_() { pn_free(_c_obj); }
 
 static_assert(sizeof(data) == sizeof(pn_data_t*), "data size wrong");
 static_assert(sizeof(data_ref) == sizeof(pn_data_t**), "data_ref size wrong");
@@ -46,6 +46,8 @@ output err{pn_stderr};
 input::input(string_view path, text_mode mode)
         : _c_obj{pn_path_input(path.copy().c_str(), internal::path_flag(mode, false))} {}
 
+input::input(string_view path, map_mode) : _c_obj{pn_mmap_input(path.copy().c_str())} {}
+
 input& input::check() & {
     if (!c_obj()->type || error()) {
         throw std::system_error(errno, std::system_category());
@@ -89,4 +91,8 @@ bool parse(input_view in, value_ptr out, pn_error_t* error) {
     return pn_parse(in.c_obj(), out->c_obj(), error);
 }
 
+bool parse_binary(input_view in, value_ptr out, pn_error_t* error) {
+    return pn_parse_binary(in.c_obj(), out->c_obj(), error);
+}
+
 }  // namespace pn
@@ -0,0 +1,71 @@
+// Copyright 2017 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <pn/frozen>
+
+namespace pn {
+
+// Stand-ins for values of the wrong type, or missing from a map. An empty container's body is just
+// its zero count, so both kinds can point at `empty_body`.
+static const uint64_t          empty_body = 0;
+static const pn_frozen_value_t null_value = {PN_NULL, {0}};
+static const pn_frozen_value_t empty_map  = {PN_MAP, {0}};
+
+static const uint8_t* body(const frozen_value& x) {
+    return static_cast<const uint8_t*>(x.doc()) + x.c_obj()->offset;
+}
+
+frozen_value::frozen_value(data_view doc)
+        : _doc{doc.data()}, _c_obj{pn_frozen_root(doc.data(), doc.size())} {
+    if (!_c_obj) {
+        _c_obj = &null_value;
+    }
+}
+
+data_view frozen_value::as_data() const {
+    if (!is_data()) {
+        return data_view{};
+    }
+    const uint64_t* d = reinterpret_cast<const uint64_t*>(body(*this));
+    return data_view{reinterpret_cast<const uint8_t*>(d + 1), static_cast<int>(d[0])};
+}
+
+string_view frozen_value::as_string() const {
+    if (!is_string()) {
+        return string_view{};
+    }
+    const uint64_t* s = reinterpret_cast<const uint64_t*>(body(*this));
+    return string_view{reinterpret_cast<const char*>(s + 1), static_cast<int>(s[0])};
+}
+
+frozen_array frozen_value::as_array() const {
+    if (!is_array()) {
+        return frozen_array{&empty_body, &empty_body};
+    }
+    return frozen_array{doc(), reinterpret_cast<const uint64_t*>(body(*this))};
+}
+
+frozen_map frozen_value::as_map() const {
+    if (!is_map()) {
+        return frozen_map{&empty_body, &empty_map};
+    }
+    return frozen_map{doc(), c_obj()};
+}
+
+frozen_value frozen_map::get(string_view k) const {
+    const pn_frozen_value_t* x = pn_frozen_mapget(_doc, _c_obj, k.data(), k.size());
+    return frozen_value{_doc, x ? x : &null_value};
+}
+
+}  // namespace pn
@@ -0,0 +1,269 @@
+// Copyright 2017 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <pn/lazy>
+
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "../../c/src/common.h"
+#include "../../c/src/parse.h"
+
+namespace pn {
+namespace internal {
+
+struct lazy_node {
+    ::pn::type                              type = PN_NULL;
+    value                                   scalar;
+    std::vector<lazy_value>                 values;   // of an array
+    std::vector<lazy_key_value>             entries;  // of a map, in order
+    std::unordered_map<std::string, size_t> index;    // into `entries`, by key
+
+    // The text of an array or map that was skipped, and the number of its first line, until it's
+    // parsed. `begin` is null otherwise.
+    const char* begin  = nullptr;
+    const char* end    = nullptr;
+    size_t      lineno = 0;
+
+    static bool parse(
+            lazy_node* root, const char* begin, const char* end, size_t lineno,
+            pn_error_t* error);
+    static lazy_value wrap(std::shared_ptr<lazy_node> x) { return lazy_value{std::move(x)}; }
+    static void load_all(lazy_node* x);
+    static void copy(const lazy_node* x, pn_value_t* out);
+
+    void       load();
+    lazy_node* add(const pn_value_t* key);
+};
+
+}  // namespace internal
+
+using internal::lazy_node;
+
+static const std::vector<lazy_value>     empty_values;
+static const std::vector<lazy_key_value> empty_entries;
+
+static const std::shared_ptr<lazy_node>& null_node() {
+    static const std::shared_ptr<lazy_node> node = std::make_shared<lazy_node>();
+    return node;
+}
+
+static bool in_text(const char* p, const char* begin, const char* end) {
+    return !std::less<const char*>()(p, begin) && std::less<const char*>()(p, end);
+}
+
+// Returns true if the lexer's current token is the first on its line, and the line is part of
+// [begin, end) rather than a copy of the final line (see view_getline()).
+static bool starts_line(const pn_lexer_t& lex, const char* begin, const char* end) {
+    if (!in_text(lex.line.begin, begin, end)) {
+        return false;
+    }
+    for (const char* p = lex.line.begin; p < lex.token.begin; ++p) {
+        if ((*p != ' ') && (*p != '\t')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns where in [begin, end) the lexer's current line starts, or `end` at the end of input. The
+// final line is copied if it has no newline, and the lexer adds two bytes after it.
+static const char* line_start(const pn_lexer_t& lex, const char* begin, const char* end) {
+    if (lex.line.begin == lex.line.end) {
+        return end;
+    } else if (in_text(lex.line.begin, begin, end)) {
+        return lex.line.begin;
+    }
+    return end - (lex.line.end - lex.line.begin - 2);
+}
+
+bool lazy_node::parse(
+        lazy_node* root, const char* begin, const char* end, size_t lineno, pn_error_t* error) {
+    pn_input_t in = pn_view_input(begin, end - begin);
+    pn_lexer_t lex;
+    pn_lexer_init(&lex, &in);
+    pn_parser_t prs;
+    pn_parser_init(&prs, &lex, 64);
+
+    std::vector<lazy_node*> stack;
+    bool                    ok = true;
+    while (ok && pn_parser_next(&prs, error)) {
+        if ((prs.evt.type == PN_EVT_ARRAY_OUT) || (prs.evt.type == PN_EVT_MAP_OUT)) {
+            stack.pop_back();
+            continue;
+        } else if (prs.evt.type == PN_EVT_ERROR) {
+            ok = false;
+            break;
+        }
+
+        lazy_node* x = stack.empty() ? root : stack.back()->add(&prs.evt.k);
+        switch (prs.evt.type) {
+            case PN_EVT_ARRAY_IN:
+            case PN_EVT_MAP_IN:
+                x->type = (prs.evt.type == PN_EVT_ARRAY_IN) ? PN_ARRAY : PN_MAP;
+                if (stack.empty() || !(prs.evt.flags & PN_EVT_LONG) ||
+                    !starts_line(lex, begin, end)) {
+                    stack.push_back(x);
+                    break;
+                }
+                x->begin  = lex.line.begin;
+                x->lineno = lineno + lex.lineno - 1;
+                ok        = pn_parser_skip_block(&prs, error) && (prs.evt.type != PN_EVT_ERROR);
+                x->end    = line_start(lex, begin, end);
+                break;
+
+            default:
+                x->type = prs.evt.x.type;
+                pn_set(x->scalar.c_obj(), 'X', &prs.evt.x);
+                break;
+        }
+    }
+    if (!ok) {
+        error->lineno += lineno - 1;
+    }
+
+    pn_parser_clear(&prs);
+    pn_lexer_clear(&lex);
+    pn_input_close(&in);
+    return ok;
+}
+
+void lazy_node::load() {
+    if (!begin) {
+        return;
+    }
+    pn_error_t error;
+    if (!parse(this, begin, end, lineno, &error)) {
+        values.clear();
+        entries.clear();
+        index.clear();
+        throw std::runtime_error(
+                std::to_string(error.lineno) + ":" + std::to_string(error.column) + ": " +
+                pn_strerror(error.code));
+    }
+    begin = end = nullptr;
+}
+
+lazy_node* lazy_node::add(const pn_value_t* key) {
+    auto       node = std::make_shared<lazy_node>();
+    lazy_node* x    = node.get();
+    if (type == PN_ARRAY) {
+        values.push_back(lazy_value{std::move(node)});
+        return x;
+    }
+
+    // A later duplicate key replaces the earlier value, as in pn_parse().
+    auto it = index.emplace(std::string{key->s->values, key->s->count - 1}, entries.size());
+    if (it.second) {
+        entries.push_back(lazy_key_value{&it.first->first, lazy_value{std::move(node)}});
+    } else {
+        entries[it.first->second]._value = lazy_value{std::move(node)};
+    }
+    return x;
+}
+
+// Parses everything under `x` first, so that copy() doesn't throw halfway through.
+void lazy_node::load_all(lazy_node* x) {
+    x->load();
+    for (const lazy_value& v : x->values) {
+        load_all(v._node.get());
+    }
+    for (const lazy_key_value& kv : x->entries) {
+        load_all(kv._value._node.get());
+    }
+}
+
+void lazy_node::copy(const lazy_node* x, pn_value_t* out) {
+    switch (x->type) {
+        case PN_ARRAY:
+            pn_setv(out, "");
+            for (const lazy_value& v : x->values) {
+                pn_value_t y;
+                copy(v._node.get(), &y);
+                pn_arrayext(&out->a, "X", &y);
+            }
+            break;
+
+        case PN_MAP:
+            pn_setkv(out, "");
+            for (const lazy_key_value& kv : x->entries) {
+                pn_value_t y;
+                copy(kv._value._node.get(), &y);
+                pn_mapappend(&out->m, pn_string_new(kv._key->data(), kv._key->size()), &y);
+            }
+            break;
+
+        default: pn_set(out, 'x', x->scalar.c_obj()); break;
+    }
+}
+
+lazy_value::lazy_value() : _node{null_node()} {}
+
+::pn::type  lazy_value::type() const { return _node->type; }
+bool        lazy_value::as_bool() const { return _node->scalar.as_bool(); }
+int64_t     lazy_value::as_int() const { return _node->scalar.as_int(); }
+double      lazy_value::as_float() const { return _node->scalar.as_float(); }
+double      lazy_value::as_number() const { return _node->scalar.as_number(); }
+data_view   lazy_value::as_data() const { return _node->scalar.as_data(); }
+string_view lazy_value::as_string() const { return _node->scalar.as_string(); }
+bool        lazy_value::is_parsed() const { return !_node->begin; }
+
+lazy_array lazy_value::as_array() const {
+    if (!is_array()) {
+        return lazy_array{nullptr, &empty_values};
+    }
+    _node->load();
+    return lazy_array{_node, &_node->values};
+}
+
+lazy_map lazy_value::as_map() const {
+    if (!is_map()) {
+        return lazy_map{nullptr, &empty_entries};
+    }
+    _node->load();
+    return lazy_map{_node, &_node->entries};
+}
+
+value lazy_value::copy() const {
+    lazy_node::load_all(_node.get());
+    pn_value_t x;
+    lazy_node::copy(_node.get(), &x);
+    return value{x};
+}
+
+bool lazy_map::has(string_view k) const {
+    return _node && _node->index.count(k.cpp_str());
+}
+
+lazy_value lazy_map::get(string_view k) const {
+    if (!_node) {
+        return lazy_value{};
+    }
+    auto it = _node->index.find(k.cpp_str());
+    return (it == _node->index.end()) ? lazy_value{} : (*_entries)[it->second].value();
+}
+
+bool parse_lazy(string_view text, lazy_value* out, pn_error_t* error) {
+    pn_error_t ignore_error;
+    error     = error ? error : &ignore_error;
+    auto node = std::make_shared<lazy_node>();
+    if (!lazy_node::parse(node.get(), text.data(), text.data() + text.size(), 1, error)) {
+        return false;
+    }
+    *out = lazy_node::wrap(std::move(node));
+    return true;
+}
+
+}  // namespace pn
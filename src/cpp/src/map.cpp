@@ -14,6 +14,7 @@
 
 #include <pn/map>
 
+#include "../../c/src/common.h"
 #include "../../c/src/vector.h"
 #include "./common.hpp"
 
@@ -56,17 +57,18 @@ value_cref map_get(const pn_map_t* m, const char* data, size_t size) {
 void map_clear(pn_map_t* m) {
     while (m->count > 0) {
         size_t index = --m->count;
-        free(m->values[index].key);
+        pn_free(m->values[index].key);
         pn_clear(&m->values[index].value);
     }
+    pn_mapreindex(m);
 }
 
 }  // namespace internal
 
-map::map() : _c_obj{vector_new<pn_map_t>(0)} {}
+map::map() : _c_obj{pn_map_new(0)} {}
 
 map::map(std::initializer_list<std::pair<string, value>> m)
-        : _c_obj{vector_new<pn_map_t>(m.size())} {
+        : _c_obj{pn_map_new(m.size())} {
     pn_kv_pair_t* out = _c_obj->values;
     for (const std::pair<string, value>& in : m) {
         pn_value_t k;
@@ -74,6 +76,7 @@ map::map(std::initializer_list<std::pair<string, value>> m)
         out->key = k.s;
         pn_set(&out++->value, 'x', in.second.c_obj());
     }
+    pn_mapreindex(_c_obj);
 }
 
 map::~map() { pn_mapfree(_c_obj); }
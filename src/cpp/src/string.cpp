@@ -14,6 +14,7 @@
 
 #include <pn/string>
 
+#include <algorithm>
 #include <pn/input>
 #include <pn/output>
 
@@ -85,6 +86,23 @@ struct utf<char_type, 32> {
     }
 };
 
+// Returns the offset `count` runes into `s`, or the end of `s`.
+string_view::size_type advance(string_view s, string_view::size_type count) {
+    string_view::size_type offset = 0;
+    while ((offset < s.size()) && count) {
+        string_view::size_type ascii = pn_ascii_span(s.data() + offset, s.size() - offset);
+        if (ascii) {
+            ascii = std::min(ascii, count);
+            offset += ascii;
+            count -= ascii;
+        } else {
+            offset = pn_rune_next(s.data(), s.size(), offset);
+            --count;
+        }
+    }
+    return offset;
+}
+
 }  // namespace
 
 string::string(const char* data, size_type size) : _c_obj{pn_string_new(data, size)} {}
@@ -92,7 +110,7 @@ string::string(const char16_t* data, size_type size) { utf<char16_t>::init(&_c_o
 string::string(const char32_t* data, size_type size) { utf<char32_t>::init(&_c_obj, data, size); }
 string::string(const wchar_t* data, size_type size) { utf<wchar_t>::init(&_c_obj, data, size); }
 
-string::~string() { free(_c_obj); }
+string::~string() { pn_free(_c_obj); }
 
 std::u16string string::cpp_u16str() const { return utf<char16_t>::str(data(), size()); }
 std::u32string string::cpp_u32str() const { return utf<char32_t>::str(data(), size()); }
@@ -109,7 +127,17 @@ std::wstring   string_view::cpp_wstr() const { return utf<wchar_t>::str(data(),
 static_assert(sizeof(string) == sizeof(pn_string_t*), "string size wrong");
 static_assert(sizeof(string_ref) == sizeof(pn_string_t**), "string_ref size wrong");
 
-rune::size_type rune::count(string_view s) { return std::distance(s.begin(), s.end()); }
+rune::size_type rune::count(string_view s) {
+    size_type count = 0;
+    for (size_type i = 0; i < s.size(); i = pn_rune_next(s.data(), s.size(), i), ++count) {
+        size_type ascii = pn_ascii_span(s.data() + i, s.size() - i);
+        count += ascii;
+        if ((i += ascii) == s.size()) {
+            break;
+        }
+    }
+    return count;
+}
 
 data_view string::as_data() const {
     return data_view{reinterpret_cast<const uint8_t*>(data()), size()};
@@ -124,20 +152,12 @@ data_view string_view::as_data() const {
 }
 
 string_view rune::slice(string_view s, size_type offset) {
-    auto it = s.begin();
-    for (size_type i = 0; i < offset; ++i) {
-        ++it;
-    }
-    return s.substr(it.offset());
+    return s.substr(advance(s, offset));
 }
 
 string_view rune::slice(string_view s, size_type offset, size_type size) {
-    s       = slice(s, offset);
-    auto it = s.begin();
-    for (size_type i = 0; i < size; ++i) {
-        ++it;
-    }
-    return s.substr(0, it.offset());
+    s = slice(s, offset);
+    return s.substr(0, advance(s, size));
 }
 
 string::size_type string::find(string_view needle, size_type offset) const {
@@ -0,0 +1,141 @@
+// Copyright 2017 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <pn/procyon.h>
+
+#include <gmock/gmock.h>
+#include <pn/input>
+#include <pn/output>
+#include <string>
+
+#include "./matchers.hpp"
+
+using BinaryTest = ::testing::Test;
+using ::testing::Eq;
+
+namespace pntest {
+namespace {
+
+std::string dump_binary(const pn::value& x) {
+    pn::value d;
+    pn_set(d.c_obj(), '$', "", static_cast<size_t>(0));
+    pn_output_t out = pn_data_output(&d.c_obj()->d);
+    EXPECT_THAT(pn_dump_binary(&out, x.c_obj()), Eq(true));
+    return std::string(reinterpret_cast<const char*>(d.c_obj()->d->values), d.c_obj()->d->count);
+}
+
+std::pair<pn::value, pn_error_t> parse_binary(const std::string& arg) {
+    pn::value  x;
+    pn_error_t error = {PN_OK, 0, 0};
+    pn_input_t in    = pn_view_input(arg.data(), arg.size());
+    if (!pn_parse_binary(&in, x.c_obj(), &error)) {
+        return std::make_pair(nullptr, error);
+    }
+    return std::make_pair(std::move(x), error);
+}
+
+TEST_F(BinaryTest, Encoding) {
+    EXPECT_THAT(dump_binary(nullptr), Eq(std::string("\0", 1)));
+    EXPECT_THAT(dump_binary(false), Eq("\1"));
+    EXPECT_THAT(dump_binary(true), Eq("\2"));
+    EXPECT_THAT(dump_binary(0), Eq(std::string("\3\0", 2)));
+    EXPECT_THAT(dump_binary(-1), Eq("\3\1"));
+    EXPECT_THAT(dump_binary(1), Eq("\3\2"));
+    EXPECT_THAT(dump_binary(64), Eq("\3\200\1"));
+    EXPECT_THAT(
+            dump_binary(INT64_MIN), Eq("\3\377\377\377\377\377\377\377\377\377\1"));
+    EXPECT_THAT(dump_binary(1.0), Eq(std::string("\4\0\0\0\0\0\0\360\77", 9)));
+    EXPECT_THAT(dump_binary(set('$', "\1\2", static_cast<size_t>(2))), Eq("\5\2\1\2"));
+    EXPECT_THAT(dump_binary("hi"), Eq("\6\2hi"));
+    EXPECT_THAT(dump_binary(setv("in", 1)), Eq(std::string("\7\2\3\2\0", 5)));
+    EXPECT_THAT(dump_binary(setkv("s?", "k", true)), Eq("\10\1\1k\2"));
+}
+
+TEST_F(BinaryTest, RoundTrip) {
+    std::string large;
+    for (int i = 0; i < 1000; ++i) {
+        large += "k" + std::to_string(i) + ": [\"" + std::string(i % 100, 'x') + "\", $0102]\n";
+    }
+
+    for (const std::string& text :
+         {std::string("null"), std::string("[true, false, 0, -1, 9223372036854775807]"),
+          std::string("[-9223372036854775808, 1.5, -0.0, inf, -inf, 1e-310]"),
+          std::string("[\"\", \"\\u0000\", \"\xf0\x9f\x92\xa9\", $, $00ff]"),
+          std::string("one: 1\ntwo:\n  * 2\n  * |\n    | two\nthree: {3: {}}\nfour: []"), large}) {
+        pn::value  x;
+        pn_error_t error;
+        pn_input_t in = pn_view_input(text.data(), text.size());
+        ASSERT_THAT(pn_parse(&in, x.c_obj(), &error), Eq(true)) << text;
+        pn_input_close(&in);
+
+        auto y = parse_binary(dump_binary(x));
+        EXPECT_THAT(y.second.code, Eq(PN_OK)) << text;
+        EXPECT_THAT(pn_cmp(y.first.c_obj(), x.c_obj()), Eq(0)) << text;
+    }
+
+    auto nan = parse_binary(dump_binary(set('d', NAN)));
+    EXPECT_THAT(nan.first.c_obj()->type, Eq(PN_FLOAT));
+    EXPECT_THAT(std::isnan(nan.first.c_obj()->f), Eq(true));
+
+    auto dup = parse_binary("\10\2\1k\3\2\1k\3\4");
+    EXPECT_THAT(pn_cmp(dup.first.c_obj(), setkv("si", "k", 2).c_obj()), Eq(0));
+}
+
+TEST_F(BinaryTest, Bad) {
+    struct {
+        std::string     in;
+        pn_error_code_t code;
+        size_t          column;
+    } tests[] = {
+            {"", PN_ERROR_BINARY, 1},
+            {"\11", PN_ERROR_BINARY, 1},
+            {"\3", PN_ERROR_BINARY, 2},
+            {"\3\200", PN_ERROR_BINARY, 3},
+            {"\3\377\377\377\377\377\377\377\377\377\2", PN_ERROR_BINARY, 12},
+            {std::string("\4\0\0\0", 4), PN_ERROR_BINARY, 2},
+            {"\6\3hi", PN_ERROR_BINARY, 3},
+            {std::string("\6\2hi\0", 5), PN_ERROR_BINARY, 5},
+            {"\7\2\2", PN_ERROR_BINARY, 3},
+            {std::string("\7\377\377\377\377\17\0", 7), PN_ERROR_BINARY, 7},
+            {"\10\1\1k", PN_ERROR_BINARY, 5},
+            {"\10\1\1k\11", PN_ERROR_BINARY, 5},
+    };
+    for (const auto& t : tests) {
+        auto result = parse_binary(t.in);
+        EXPECT_THAT(result.second.code, Eq(t.code)) << testing::PrintToString(t.in);
+        EXPECT_THAT(result.second.column, Eq(t.column)) << testing::PrintToString(t.in);
+    }
+
+    std::string deep;
+    for (int i = 0; i < 63; ++i) {
+        deep += "\7\1";
+    }
+    EXPECT_THAT(parse_binary(deep + std::string(1, '\0')).second.code, Eq(PN_OK));
+    auto too_deep = parse_binary(deep + "\7\1" + std::string(1, '\0'));
+    EXPECT_THAT(too_deep.second.code, Eq(PN_ERROR_RECURSION));
+    EXPECT_THAT(too_deep.second.column, Eq(129u));
+}
+
+TEST_F(BinaryTest, Cpp) {
+    pn::value x = setkv("sisn", "a", 1, "b");
+    pn::string s;
+    s.output().dump_binary(x);
+    pn::value y;
+    pn_error_t error;
+    ASSERT_THAT(pn::parse_binary(pn::string_view{s}.input(), &y, &error), Eq(true));
+    EXPECT_THAT(pn_cmp(y.c_obj(), x.c_obj()), Eq(0));
+}
+
+}  // namespace
+}  // namespace pntest
@@ -16,6 +16,7 @@
 
 #include <gmock/gmock.h>
 #include <pn/output>
+#include <string>
 
 #include "./matchers.hpp"
 
@@ -82,6 +83,15 @@ TEST_F(DumpTest, Scalar) {
     EXPECT_THAT(dump('d', 0.5), IsString("0.5\n"));
 }
 
+TEST_F(DumpTest, IntDigits) {
+    for (int64_t i = 1; i <= INT64_MAX / 10; i *= 10) {
+        for (int64_t x : {i - 1, i, i + 1, (i * 10) - 1}) {
+            EXPECT_THAT(dump('q', x), IsString(std::to_string(x) + "\n"));
+            EXPECT_THAT(dump('q', -x), IsString(std::to_string(-x) + "\n"));
+        }
+    }
+}
+
 TEST_F(DumpTest, FloatRounding) {
     struct {
         double      d;
@@ -228,6 +238,14 @@ TEST_F(DumpTest, Data) {
             IsString("$\t0011 2233 4455 6677 8899 aabb ccdd eeff\n"
                      "$\t0011 2233 4455 6677 8899 aabb ccdd eeff\n"
                      "$\t0011 2233 4455 6677 8899\n"));
+
+    EXPECT_THAT(
+            dump('$',
+                 "\x00\x11\x22\x33\x44\x55\x66\x77\x88\x99\xaa\xbb\xcc\xdd\xee\xff"
+                 "\x01\x23\x45",
+                 static_cast<size_t>(19)),
+            IsString("$\t0011 2233 4455 6677 8899 aabb ccdd eeff\n"
+                     "$\t0123 45\n"));
 }
 
 TEST_F(DumpTest, String) {
@@ -238,6 +256,9 @@ TEST_F(DumpTest, String) {
     EXPECT_THAT(dump('s', "\177"), IsString("\"\\u007f\"\n"));
     EXPECT_THAT(dump('s', "procyon"), IsString("\"procyon\"\n"));
     EXPECT_THAT(dump('s', "procyon\n"), IsString(">\tprocyon\n"));
+    EXPECT_THAT(
+            dump('s', "\"quoted\" \\back\\slashed\\ \343\201\213\tescaped\b"),
+            IsString("\"\\\"quoted\\\" \\\\back\\\\slashed\\\\ \343\201\213\\tescaped\\b\"\n"));
 
     EXPECT_THAT(
             dump('s',
@@ -313,6 +334,39 @@ TEST_F(DumpTest, List) {
                                                   "\t*\t\"b\"\n"));
 }
 
+TEST_F(DumpTest, Large) {
+    // Output much larger than the dump buffer is flushed in pieces, and arrives intact.
+    pn::array   a;
+    std::string expected;
+    for (int i = 0; i < 2000; ++i) {
+        std::string s = "item " + std::to_string(i);
+        a.push_back(pn::string{s});
+        expected += "*\t\"" + s + "\"\n";
+    }
+    std::string big(10000, 'x');
+    a.push_back(pn::string{big});
+    expected += "*\t>\t" + big + "\n\t!\n";
+
+    pn::value x{std::move(a)};
+    EXPECT_THAT(dump(x.c_obj()), IsString(expected));
+}
+
+TEST_F(DumpTest, NestedMap) {
+    // The inner map's layout is planned while the outer map's is still in use.
+    pn_value_t* inner;
+    pn::value   x;
+    pn_setkv(x.c_obj(), "sisNsi", "a", 1, "inner", &inner, "long key", 2);
+    pn_setkv(inner, "");
+    std::string expected = "a:           1\ninner:";
+    for (int i = 0; i < 100; ++i) {
+        std::string key = "k" + std::to_string(i);
+        pn_mapset(&inner->m, 's', 's', key.c_str(), "say \"hi\"");
+        expected += "\n\t" + key + ":" + std::string(5 - key.size(), ' ') + "\"say \\\"hi\\\"\"";
+    }
+    expected += "\n\"long key\":  2\n";
+    EXPECT_THAT(dump(x.c_obj()), IsString(expected));
+}
+
 TEST_F(DumpTest, Map) {
     EXPECT_THAT(dumpkv("sn", "null"), IsString("{null: null}\n"));
     EXPECT_THAT(dumpkv("s?s?", "t", true, "f", false), IsString("{t: true, f: false}\n"));
@@ -151,6 +151,28 @@ TEST_F(FloatTest, ParseOne) {
     }
 }
 
+TEST_F(FloatTest, ParseHalfway) {
+    // Exactly between two doubles: round to the one with an even mantissa.
+    struct {
+        const char* s;
+        double      d;
+    } tests[] = {
+            {"9007199254740993", 9007199254740992.0},
+            {"9007199254740995", 9007199254740996.0},
+            {"9007199254740993e0", 9007199254740992.0},
+            {"9007199254740993000e-3", 9007199254740992.0},
+            {"1.00000000000000011102230246251565404236316680908203125", 1.0},
+            {"1.00000000000000011102230246251565404236316680908203126", 1.0000000000000002},
+            {"7.2057594037927933e16", 72057594037927936.0},
+    };
+    for (const auto& test : tests) {
+        double          d   = 0.0;
+        pn_error_code_t err = PN_OK;
+        EXPECT_THAT(pn::strtod(test.s, &d, &err), Eq(true)) << test.s << ": " << err;
+        EXPECT_THAT(d, Eq(test.d)) << test.s;
+    }
+}
+
 TEST_F(FloatTest, ParseSpecial) {
     struct {
         char        sign;
@@ -193,7 +215,7 @@ TEST_F(FloatTest, ParseBadValues) {
 }
 
 pn::string dtoa(double d) {
-    char buffer[32];
+    char buffer[PN_DTOA_SIZE];
     return pn::string{pn_dtoa(buffer, d)};
 }
 
@@ -383,4 +405,38 @@ TEST_F(FloatTest, PrintExtrema) {
     EXPECT_THAT(dtoa(1.7976931348623157e308), Eq("1.7976931348623157e+308"));
 }
 
+TEST_F(FloatTest, PrintBoundaries) {
+    // Powers of two have a narrower gap below than above.
+    EXPECT_THAT(dtoa(std::ldexp(1.0, 63)), Eq("9223372036854776000.0"));
+    EXPECT_THAT(dtoa(std::ldexp(1.0, -25)), Eq("2.9802322387695312e-08"));
+    EXPECT_THAT(dtoa(std::ldexp(1.0, -1022)), Eq("2.2250738585072014e-308"));
+    EXPECT_THAT(dtoa(std::ldexp(1.0, -1023)), Eq("1.1125369292536007e-308"));
+    EXPECT_THAT(dtoa(1e23), Eq("1e+23"));
+    EXPECT_THAT(dtoa(0.3), Eq("0.3"));
+    EXPECT_THAT(dtoa(0.1 + 0.2), Eq("0.30000000000000004"));
+}
+
+TEST_F(FloatTest, PrintLongest) {
+    EXPECT_THAT(dtoa(-1.2345678901234567e31), Eq("-12345678901234567000000000000000.0"));
+    EXPECT_THAT(dtoa(-1.2345678901234567e-4), Eq("-0.00012345678901234567"));
+}
+
+TEST_F(FloatTest, PrintRoundTrip) {
+    uint64_t bits = 1;
+    for (int i = 0; i < 100000; ++i) {
+        bits = (bits * 6364136223846793005) + 1442695040888963407;
+        double d;
+        memcpy(&d, &bits, sizeof(d));
+        if (!std::isfinite(d)) {
+            continue;
+        }
+        char repr[PN_DTOA_SIZE];
+        pn_dtoa(repr, d);
+        double          parsed;
+        pn_error_code_t err;
+        pn_strtod(repr, strlen(repr), &parsed, &err);
+        EXPECT_THAT(memcmp(&parsed, &d, sizeof(d)), Eq(0)) << repr;
+    }
+}
+
 }  // namespace pntest
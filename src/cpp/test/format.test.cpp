@@ -102,6 +102,11 @@ TEST_F(FormatTest, Scalar) {
 
     EXPECT_THAT(pn::format<float>("format: {0}", 1.0), IsString("format: 1.0"));
     EXPECT_THAT(pn::format<double>("format: {0}", 1.0), IsString("format: 1.0"));
+
+    EXPECT_THAT(pn::format("{0}", INT32_MIN), IsString("-2147483648"));
+    EXPECT_THAT(pn::format("{0}", UINT32_MAX), IsString("4294967295"));
+    EXPECT_THAT(pn::format("{0}", INT64_MIN), IsString("-9223372036854775808"));
+    EXPECT_THAT(pn::format("{0}", UINT64_MAX), IsString("18446744073709551615"));
 }
 
 TEST_F(FormatTest, Vector) {
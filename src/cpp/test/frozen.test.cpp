@@ -0,0 +1,155 @@
+// Copyright 2017 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <pn/procyon.h>
+
+#include <gmock/gmock.h>
+#include <pn/frozen>
+#include <pn/input>
+#include <pn/output>
+#include <string>
+
+#include "./matchers.hpp"
+
+using FrozenTest = ::testing::Test;
+using ::testing::Eq;
+
+namespace pntest {
+namespace {
+
+pn::value parse(const std::string& text) {
+    pn::value  x;
+    pn_error_t error;
+    pn_input_t in = pn_view_input(text.data(), text.size());
+    EXPECT_THAT(pn_parse(&in, x.c_obj(), &error), Eq(true)) << text;
+    pn_input_close(&in);
+    return x;
+}
+
+pn::data freeze(const pn::value& x) {
+    pn::data d;
+    d.output().dump_frozen(x).check();
+    return d;
+}
+
+// Compares a frozen value with the value it was made from.
+bool equal(pn::frozen_value f, pn::value_cref x) {
+    if (f.type() != x.type()) {
+        return false;
+    }
+    switch (f.type()) {
+        case PN_NULL: return true;
+        case PN_BOOL: return f.as_bool() == x.as_bool();
+        case PN_INT: return f.as_int() == x.as_int();
+        case PN_FLOAT: return pn::value{f.as_float()} == x;
+        case PN_DATA: return f.as_data() == x.as_data();
+        case PN_STRING: return f.as_string() == x.as_string();
+        case PN_ARRAY: {
+            pn::frozen_array fa = f.as_array();
+            pn::array_cref   xa = x.as_array();
+            if (fa.size() != xa.size()) {
+                return false;
+            }
+            for (int i = 0; i < fa.size(); ++i) {
+                if (!equal(fa[i], xa[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case PN_MAP: {
+            pn::frozen_map fm = f.as_map();
+            pn::map_cref   xm = x.as_map();
+            if (fm.size() != xm.size()) {
+                return false;
+            }
+            auto it = xm.begin();
+            for (pn::frozen_key_value kv : fm) {
+                if ((kv.key() != (*it).key()) || !equal(kv.value(), (*it).value()) ||
+                    !equal(fm.get(kv.key()), (*it).value()) || !fm.has(kv.key())) {
+                    return false;
+                }
+                ++it;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+TEST_F(FrozenTest, Equivalent) {
+    std::string large;
+    for (int i = 0; i < 1000; ++i) {
+        large += "k" + std::to_string((i * 7919) % 1000) + ": [\"" + std::string(i % 10, 'x') +
+                 "\", $0102]\n";
+    }
+
+    for (const std::string& text :
+         {std::string("null"), std::string("true"), std::string("-9223372036854775808"),
+          std::string("1.5"), std::string("$0001020304050607"), std::string("\"\""),
+          std::string("[true, false, 0, -1, 9223372036854775807, inf, -0.0, \"\", $]"),
+          std::string("one: 1\ntwo:\n  * 2\n  * |\n    | two\nthree: {3: {}}\nfour: []"),
+          large}) {
+        pn::value x = parse(text);
+        pn::data  d = freeze(x);
+        EXPECT_THAT(d.size() % 8, Eq(0)) << text;
+        EXPECT_THAT(equal(pn::frozen_value{d}, x), Eq(true)) << text;
+    }
+}
+
+TEST_F(FrozenTest, Access) {
+    pn::value x = parse("b: {c: [1, 2.5, \"three\"]}\na: \"\\u00e9\"\n\"\": null\nz: $ff\n");
+    pn::data  d = freeze(x);
+
+    pn::frozen_value root{d};
+    ASSERT_THAT(root.is_map(), Eq(true));
+    pn::frozen_map m = root.as_map();
+    EXPECT_THAT(m.size(), Eq(4));
+    EXPECT_THAT((*m.begin()).key(), Eq(pn::string_view{"b"}));
+    EXPECT_THAT(m.has(""), Eq(true));
+    EXPECT_THAT(m.has("y"), Eq(false));
+    EXPECT_THAT(m.get("y").is_null(), Eq(true));
+    EXPECT_THAT(m.get("a").as_string(), Eq(pn::string_view{"\u00e9"}));
+    EXPECT_THAT(m.get("z").as_data(), Eq(pn::data_view{(const uint8_t*)"\377", 1}));
+
+    pn::frozen_array c = m.get("b").as_map().get("c").as_array();
+    ASSERT_THAT(c.size(), Eq(3));
+    EXPECT_THAT(c[0].as_int(), Eq(1));
+    EXPECT_THAT(c[1].as_float(), Eq(2.5));
+    EXPECT_THAT(c[1].as_number(), Eq(2.5));
+    EXPECT_THAT(c.back().as_string(), Eq(pn::string_view{"three"}));
+    EXPECT_THAT(c.end() - c.begin(), Eq(3));
+
+    // Strings are NUL-terminated in place.
+    EXPECT_THAT(c[2].as_string().data()[5], Eq('\0'));
+
+    // Accessors of the wrong type give empty values, as with value_cref.
+    EXPECT_THAT(c[0].as_string(), Eq(pn::string_view{}));
+    EXPECT_THAT(c[0].as_array().empty(), Eq(true));
+    EXPECT_THAT(c[0].as_map().empty(), Eq(true));
+    EXPECT_THAT(c[0].as_map().get("a").is_null(), Eq(true));
+    EXPECT_THAT(c[2].as_int(), Eq(0));
+}
+
+TEST_F(FrozenTest, NotFrozen) {
+    pn::data d;
+    EXPECT_THAT(pn::frozen_value{d}.is_null(), Eq(true));
+    d = freeze(parse("[1]"));
+    d.data()[0] ^= 1;
+    EXPECT_THAT(pn::frozen_value{d}.is_null(), Eq(true));
+    EXPECT_THAT(pn_frozen_root(d.data() + 1, d.size() - 1), Eq(nullptr));
+}
+
+}  // namespace
+}  // namespace pntest
@@ -17,11 +17,22 @@
 #include <gmock/gmock.h>
 #include <limits>
 #include <pn/input>
+#include <pn/map>
 #include <pn/output>
+#include <string>
+
+#ifndef _WIN32
+#include <condition_variable>
+#include <mutex>
+#include <signal.h>
+#include <thread>
+#include <unistd.h>
+#endif
 
 #include "./matchers.hpp"
 
-using IoTest = ::testing::Test;
+using IoTest     = ::testing::Test;
+using StreamTest = ::testing::Test;
 using ::testing::Eq;
 
 namespace pntest {
@@ -86,7 +97,68 @@ class FileIoTest : public testing::Test {
     FILE* _file;
 };
 
+#ifndef _WIN32
+class MmapIoTest : public FileIoTest {
+  public:
+    ~MmapIoTest() {
+        if (!_path.empty()) {
+            unlink(_path.c_str());
+        }
+    }
+
+    pn::input input(pn::string_view s) {
+        if (_path.empty()) {
+            char path[] = "/tmp/pn-io-test.XXXXXX";
+            close(mkstemp(path));
+            _path = path;
+        }
+        pn::output out{_path, pn::binary};
+        out.write(s.as_data());
+        out = pn::output{};
+        return pn::input{_path, pn::mapped};
+    }
+    pn::input input(const char* data, int size) { return input(pn::string{data, size}); }
+
+  private:
+    std::string _path;
+};
+
+// Reads from a pipe, which can't seek, so its lines are read one at a time. Each input is written
+// by a thread of its own, which stops early if the input is closed first.
+class PipeIoTest : public FileIoTest {
+  public:
+    PipeIoTest() { signal(SIGPIPE, SIG_IGN); }
+    ~PipeIoTest() {
+        for (std::thread& t : _writers) {
+            t.join();
+        }
+    }
+
+    pn::input input(pn::string_view s) {
+        int fds[2];
+        EXPECT_THAT(pipe(fds), Eq(0));
+        _writers.emplace_back([fd = fds[1], data = std::string{s.data(), size_t(s.size())}] {
+            for (size_t i = 0; i < data.size();) {
+                ssize_t n = write(fd, data.data() + i, data.size() - i);
+                if (n <= 0) {
+                    break;
+                }
+                i += n;
+            }
+            close(fd);
+        });
+        return pn::input{fdopen(fds[0], "rb")};
+    }
+    pn::input input(const char* data, int size) { return input(pn::string{data, size}); }
+
+  private:
+    std::vector<std::thread> _writers;
+};
+
+using IoTests = ::testing::Types<ViewIoTest, FileIoTest, MmapIoTest, PipeIoTest>;
+#else
 using IoTests = ::testing::Types<ViewIoTest, FileIoTest>;
+#endif
 TYPED_TEST_SUITE(IoTest, IoTests);
 
 TYPED_TEST(IoTest, ReadC) {
@@ -451,4 +523,91 @@ TYPED_TEST(IoTest, ReadAllStringCpp) {
     EXPECT_THAT(result, Eq(pn::string_view{s}));
 }
 
+TYPED_TEST(IoTest, ParseLines) {
+    // Lines that straddle the read-ahead buffer, and a final line without a newline.
+    std::string long_line;
+    for (int i = 0; i < 1000; ++i) {
+        long_line += "0123456789";
+    }
+    std::string s;
+    for (int i = 0; i < 500; ++i) {
+        s += "k" + std::to_string(i) + ": \"" + long_line.substr(0, (i * 37) % 10000) + "\"\n";
+    }
+    s += "last: \"" + long_line + "\"";
+
+    pn::value  x;
+    pn_error_t error;
+    ASSERT_THAT(pn::parse(this->input(s), &x, &error), Eq(true));
+    ASSERT_THAT(x.is_map(), Eq(true));
+    EXPECT_THAT(x.as_map().size(), Eq(501u));
+    EXPECT_THAT(x.as_map().get("k0").as_string(), Eq(""));
+    EXPECT_THAT(x.as_map().get("k499").as_string(), Eq(long_line.substr(0, (499 * 37) % 10000)));
+    EXPECT_THAT(x.as_map().get("last").as_string(), Eq(long_line));
+}
+
+#ifndef _WIN32
+TEST_F(StreamTest, ReaderLeavesRest) {
+    // Whatever the reader read ahead of the lines it used is given back to the file when it's
+    // freed, so the file can be read from where the reader stopped.
+    std::string rest;
+    for (int i = 2; i < 100; ++i) {
+        rest += "* " + std::to_string(i) + "\n";
+    }
+    FILE* f = tmpfile();
+    fputs(("* 1\n" + rest).c_str(), f);
+    rewind(f);
+
+    pn_error_t error;
+    {
+        pn::event_reader r{f};
+        ASSERT_THAT(r.next(&error), Eq(true));
+        ASSERT_THAT(r.type(), Eq(PN_EVT_ARRAY_IN));
+        ASSERT_THAT(r.next(&error), Eq(true));
+        EXPECT_THAT(r.scalar().as_int(), Eq(1));
+    }
+
+    std::string read(rest.size() + 1, '\0');
+    EXPECT_THAT(fread(&read[0], 1, read.size(), f), Eq(rest.size()));
+    read.resize(rest.size());
+    EXPECT_THAT(read, Eq(rest));
+    fclose(f);
+}
+
+TEST_F(StreamTest, PipeLines) {
+    // Each line written to a pipe is read, and its events reported, before the next is written.
+    int fds[2];
+    ASSERT_THAT(pipe(fds), Eq(0));
+    std::mutex              mu;
+    std::condition_variable cv;
+    bool                    got_first = false;
+    bool                    closed    = false;
+    std::thread             writer([&] {
+        write(fds[1], "* 1\n", 4);
+        std::unique_lock<std::mutex> lock(mu);
+        cv.wait_for(lock, std::chrono::seconds(5), [&] { return got_first; });
+        write(fds[1], "* 2\n", 4);
+        close(fds[1]);
+        closed = true;
+    });
+
+    pn::input  in{fdopen(fds[0], "rb")};
+    pn_error_t error;
+    {
+        pn::event_reader r{in};
+        ASSERT_THAT(r.next(&error), Eq(true));
+        ASSERT_THAT(r.next(&error), Eq(true));
+        EXPECT_THAT(r.scalar().as_int(), Eq(1));
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            EXPECT_THAT(closed, Eq(false));
+            got_first = true;
+        }
+        cv.notify_one();
+        EXPECT_THAT(r.next(&error), Eq(true));
+        EXPECT_THAT(r.scalar().as_int(), Eq(2));
+    }
+    writer.join();
+}
+#endif
+
 }  // namespace pntest
@@ -0,0 +1,137 @@
+// Copyright 2017 The Procyon Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <pn/procyon.h>
+
+#include <gmock/gmock.h>
+#include <pn/lazy>
+#include <stdexcept>
+#include <string>
+
+#include "./matchers.hpp"
+
+using LazyTest = ::testing::Test;
+using ::testing::Eq;
+
+namespace pntest {
+namespace {
+
+pn::value parse(const std::string& text) {
+    pn::value  x;
+    pn_error_t error;
+    pn_input_t in = pn_view_input(text.data(), text.size());
+    EXPECT_THAT(pn_parse(&in, x.c_obj(), &error), Eq(true)) << text;
+    pn_input_close(&in);
+    return x;
+}
+
+// `text` must outlive the result.
+pn::lazy_value parse_lazy(const std::string& text) {
+    pn::lazy_value x;
+    pn_error_t     error;
+    EXPECT_THAT(pn::parse_lazy(text, &x, &error), Eq(true)) << text;
+    return x;
+}
+
+TEST_F(LazyTest, Equivalent) {
+    std::string large;
+    for (int i = 0; i < 100; ++i) {
+        large += "k" + std::to_string(i) + ":\n  * " + std::to_string(i) + "\n\n  # comment\n" +
+                 "  * a: [" + std::to_string(i) + "]\n    b:\n      >  wrapped\n";
+    }
+
+    for (const std::string& text :
+         {std::string("null"), std::string("[1, {a: 2}]"), std::string("a: 1\nb: 2"),
+          std::string("* * 1\n  * 2\n* 3\n"), std::string("a:\n  b:\n    c: 1"),
+          std::string("a:\n  * 1\nb:\n\t* 2\n\nc: 3\n"), std::string("a:\n  b: 1\n  c: 2"),
+          std::string("a:\n  b: 1\n  c: 2\nd: 3"), std::string("a: 1\na:\n  * 2\n"),
+          std::string("    a:\n      b: 1\n    c: 2\n"),
+          std::string("* a: 1\n  b:\n    c: 2\n* $01\n  $02\n"), large}) {
+        pn::lazy_value x = parse_lazy(text);
+        EXPECT_THAT(x.copy() == parse(text), Eq(true)) << text;
+    }
+}
+
+TEST_F(LazyTest, Deferred) {
+    std::string text =
+            "a: 1\n"
+            "b:\n"
+            "  c:\n"
+            "    * 2\n"
+            "  d: [3, {e: 4}]\n"
+            "f:\n"
+            "  * |  five\n"
+            "g: {h: 6}\n";
+    pn::lazy_value x = parse_lazy(text);
+    ASSERT_THAT(x.is_map(), Eq(true));
+    EXPECT_THAT(x.is_parsed(), Eq(true));
+
+    pn::lazy_map m = x.as_map();
+    EXPECT_THAT(m.size(), Eq(4));
+    EXPECT_THAT(m.has("b"), Eq(true));
+    EXPECT_THAT(m.has("c"), Eq(false));
+    EXPECT_THAT(m.get("c").is_null(), Eq(true));
+    EXPECT_THAT(m.get("a").as_int(), Eq(1));
+    EXPECT_THAT(m.get("g").is_parsed(), Eq(true));
+    EXPECT_THAT(m.get("g").as_map().get("h").as_int(), Eq(6));
+
+    // Long-form containers on their own lines have a type, but no contents, until accessed.
+    pn::lazy_value b = m.get("b");
+    EXPECT_THAT(b.is_map(), Eq(true));
+    EXPECT_THAT(b.is_parsed(), Eq(false));
+    EXPECT_THAT(m.get("f").is_parsed(), Eq(false));
+
+    pn::lazy_map bm = b.as_map();
+    EXPECT_THAT(b.is_parsed(), Eq(true));
+    EXPECT_THAT(bm.get("c").is_parsed(), Eq(false));
+    EXPECT_THAT(bm.get("c").as_array().front().as_int(), Eq(2));
+    EXPECT_THAT(bm.get("d").as_array()[1].as_map().get("e").as_number(), Eq(4.0));
+    EXPECT_THAT((*bm.begin()).key(), Eq(pn::string_view{"c"}));
+    EXPECT_THAT(m.get("f").as_array().back().as_string(), Eq(pn::string_view{" five\n"}));
+    EXPECT_THAT(m.get("f").as_array().end() - m.get("f").as_array().begin(), Eq(1));
+
+    // Accessors of the wrong type give empty values, as with value_cref.
+    EXPECT_THAT(m.get("a").as_string(), Eq(pn::string_view{}));
+    EXPECT_THAT(m.get("a").as_array().empty(), Eq(true));
+    EXPECT_THAT(m.get("a").as_map().get("a").is_null(), Eq(true));
+    EXPECT_THAT(b.as_int(), Eq(0));
+}
+
+TEST_F(LazyTest, Errors) {
+    pn::lazy_value x;
+    pn_error_t     error;
+    EXPECT_THAT(pn::parse_lazy("a: 1\nb: }\n", &x, &error), Eq(false));
+    EXPECT_THAT(error.lineno, Eq(2));
+
+    // Errors in skipped lines are only found when they are parsed.
+    std::string text =
+            "a: 1\n"
+            "b:\n"
+            "  c: 2\n"
+            "  d: }\n"
+            "e: 3\n";
+    x = parse_lazy(text);
+    pn::lazy_map m = x.as_map();
+    EXPECT_THAT(m.get("e").as_int(), Eq(3));
+    try {
+        m.get("b").as_map();
+        FAIL() << "no error";
+    } catch (std::runtime_error& e) {
+        EXPECT_THAT(std::string{e.what()}, Eq("4:6: " + std::string{pn_strerror(PN_ERROR_SHORT)}));
+    }
+    EXPECT_THROW(x.copy(), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace pntest
@@ -674,5 +674,56 @@ TEST_F(LexTest, Comment) {
     EXPECT_THAT(lex("> # comment"), LexesTo({line_in, wrap("> # comment"), line_out}));
 }
 
+TEST_F(LexTest, Runs) {
+    // Strings and comments are skipped over several bytes at a time; put their stops at each
+    // position within and across a block.
+    for (size_t n = 0; n < 20; ++n) {
+        std::string x(n, 'x');
+        EXPECT_THAT(
+                lex("\"" + x + "\\\"" + x + "\" 1"),
+                LexesTo({line_in, str("\"" + x + "\\\"" + x + "\""), i("1"), line_out}));
+        EXPECT_THAT(lex("\"" + x + "\":"), LexesTo({line_in, qkey("\"" + x + "\":"), line_out}));
+        EXPECT_THAT(
+                lex("\"" + x + "\t\343\201\213" + x + "\""),
+                LexesTo({line_in, str("\"" + x + "\t\343\201\213" + x + "\""), line_out}));
+        EXPECT_THAT(
+                lex("# " + x + "\"\\\t\343\201\213" + x),
+                LexesTo({line_in, comment("# " + x + "\"\\\t\343\201\213" + x), line_out}));
+        EXPECT_THAT(
+                lex("| " + x + "\177"),
+                LexesTo({line_in, error("| " + x + "\177", {PN_ERROR_CTRL, 1, n + 3}),
+                         line_out}));
+    }
+}
+
+TEST_F(LexTest, InPlace) {
+    // Tokens from a view point into the view, and the view is not written to, even when its
+    // final line has no newline.
+    const char data[] = {'a', ':', ' ', '1', '\n', 'b', ':', ' ', '2'};
+    pn::input  f      = pn::string_view{data, sizeof(data)}.input();
+    pn_lexer_t lex;
+    pn_lexer_init(&lex, f.c_obj());
+
+    pn_error_t error;
+    pn_lexer_next(&lex, &error);
+    EXPECT_THAT(lex.token.type, Eq(PN_TOK_LINE_IN));
+    pn_lexer_next(&lex, &error);
+    EXPECT_THAT(lex.token.type, Eq(PN_TOK_KEY));
+    EXPECT_THAT(lex.token.begin, Eq(&data[0]));
+    pn_lexer_next(&lex, &error);
+    EXPECT_THAT(lex.token.type, Eq(PN_TOK_INT));
+    EXPECT_THAT(lex.token.begin, Eq(&data[3]));
+    pn_lexer_next(&lex, &error);
+    EXPECT_THAT(lex.token.type, Eq(PN_TOK_LINE_EQ));
+    pn_lexer_next(&lex, &error);
+    EXPECT_THAT(lex.token.type, Eq(PN_TOK_KEY));
+    pn_lexer_next(&lex, &error);
+    EXPECT_THAT(lex.token.type, Eq(PN_TOK_INT));
+    EXPECT_THAT(std::string(lex.token.begin, lex.token.end), Eq("2"));
+    pn_lexer_clear(&lex);
+
+    EXPECT_THAT(std::string(data, sizeof(data)), Eq("a: 1\nb: 2"));
+}
+
 }  // namespace
 }  // namespace pntest
@@ -15,11 +15,16 @@
 #include <pn/procyon.h>
 
 #include <gmock/gmock.h>
+#include <pn/input>
+#include <pn/output>
 
 #include "../src/parse.h"
 #include "./matchers.hpp"
 
 using ParseTest = testing::Test;
+using testing::Eq;
+using testing::Lt;
+using testing::Pointee;
 using testing::PrintToString;
 
 namespace pntest {
@@ -162,6 +167,29 @@ TEST_F(ParseTest, Data) {
             parse("[$abcd\n"
                   "$1234]\n"),
             FailsToParse(PN_ERROR_ARRAY_END, 1, 7));
+
+    EXPECT_THAT(parse("$0123456789ABCDEF fedcba98 7654\t3210 ab cd ef"),
+                ParsesTo(std::vector<uint8_t>{0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+                                              0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+                                              0xab, 0xcd, 0xef}));
+}
+
+TEST_F(ParseTest, LargeData) {
+    static const char    digits[] = "0123456789abcdef";
+    static const char*   spaces[] = {"", " ", "\t", "  "};
+    std::string          in;
+    std::vector<uint8_t> expected;
+    for (int i = 0; i < 4096; ++i) {
+        if ((i % 64) == 0) {
+            in += (i ? "\n$" : "$");
+        } else if ((i % 2) == 0) {
+            in += spaces[(i / 2) % 4];
+        }
+        in += digits[(i * 7 / 16) % 16];
+        in += digits[(i * 7) % 16];
+        expected.push_back(i * 7);
+    }
+    EXPECT_THAT(parse(in), ParsesTo(expected));
 }
 
 TEST_F(ParseTest, String) {
@@ -175,6 +203,11 @@ TEST_F(ParseTest, String) {
     EXPECT_THAT(parse("\"\\u0012\""), ParsesTo("\022"));
     EXPECT_THAT(parse("\"\\u0123\""), ParsesTo("\304\243"));
     EXPECT_THAT(parse("\"\\u1234\""), ParsesTo("\341\210\264"));
+    EXPECT_THAT(parse("\"\\U0001f600\""), ParsesTo("\360\237\230\200"));
+
+    EXPECT_THAT(
+            parse("\"one\\ttwo\\u00e9three\\\\\\\"four\""),
+            ParsesTo("one\ttwo\303\251three\\\"four"));
 }
 
 TEST_F(ParseTest, XString) {
@@ -369,6 +402,10 @@ TEST_F(ParseTest, Map) {
     EXPECT_THAT(parse("{1: 1"), FailsToParse(PN_ERROR_MAP_END, 1, 6));
     EXPECT_THAT(parse("{1: 1,"), FailsToParse(PN_ERROR_MAP_KEY, 1, 7));
 
+    EXPECT_THAT(
+            parse("{one: 1, two: 2, one: 3}"),
+            ParsesTo(setkv("sisi", "one", 3, "two", 2).c_obj()));
+
     EXPECT_THAT(parse("{]"), FailsToParse(PN_ERROR_MAP_KEY, 1, 2));
     EXPECT_THAT(parse("{1: ]"), FailsToParse(PN_ERROR_SHORT, 1, 5));
     EXPECT_THAT(parse("{1: 1 ]"), FailsToParse(PN_ERROR_MAP_END, 1, 7));
@@ -463,6 +500,19 @@ TEST_F(ParseTest, XMap) {
                              .c_obj()));
 }
 
+TEST_F(ParseTest, LargeMap) {
+    std::string in;
+    pn::value   expected = setkv("");
+    for (int i = 0; i < 10000; ++i) {
+        std::string key = "k" + std::to_string(i);
+        in += key + ": " + std::to_string(i) + "\n";
+        pn_mapset(&expected.c_obj()->m, 's', 'i', key.c_str(), i);
+    }
+    in += "k0: -1\n";
+    pn_mapset(&expected.c_obj()->m, 's', 'i', "k0", -1);
+    EXPECT_THAT(parse(in), ParsesTo(expected.c_obj()));
+}
+
 TEST_F(ParseTest, Equivalents) {
     EXPECT_THAT(parse("!").first, IsValue(*parse("\"\"").first.c_obj()));
     EXPECT_THAT(parse("|\n!").first, IsValue(*parse("\"\"").first.c_obj()));
@@ -592,5 +642,215 @@ TEST_F(ParseTest, StackSmash) {
             parse(std::string(512 * 512, '*') + "null"), FailsToParse(PN_ERROR_RECURSION, 1, 64));
 }
 
+TEST_F(ParseTest, Arena) {
+    std::string large;
+    for (int i = 0; i < 10000; ++i) {
+        large += "k" + std::to_string(i) + ": [\"" + std::string(i % 100, 'x') + "\", $0102]\n";
+    }
+    large += "k0: -1\n";
+
+    for (const std::string& in :
+         {std::string("null"), std::string("\"str\""), std::string("[1, 2.5, $ff, [], {}]"),
+          std::string("one: 1\ntwo:\n  * 2\n  * |\n    | two\nthree: {3: 3}\none: -1"),
+          std::string("* \"a\"\n* b: 1\n  b: 2\n"),
+          std::string("\"k\\u00e9y\": \"a\\tb\\U0001f600\"\nd:\n  $01\n  $0203\ns:\n  * >  one\n"
+                      "    >  two\n  * |\n  * |  three\n"),
+          large}) {
+        pn_input_t expected_in = pn_view_input(in.data(), in.size());
+        pn::value  expected;
+        pn_error_t expected_error;
+        ASSERT_THAT(pn_parse(&expected_in, expected.c_obj(), &expected_error), Eq(true));
+        pn_input_close(&expected_in);
+
+        pn_arena_t* arena    = pn_arena_new();
+        pn_input_t  arena_in = pn_view_input(in.data(), in.size());
+        pn_value_t  x;
+        pn_error_t  error;
+        EXPECT_THAT(pn_parse_arena(&arena_in, arena, &x, &error), Eq(true));
+        EXPECT_THAT(pn_cmp(&x, expected.c_obj()), Eq(0)) << in;
+        pn_input_close(&arena_in);
+        pn_arena_free(arena);
+    }
+
+    pn_arena_t* arena = pn_arena_new();
+    pn_input_t  in    = pn_view_input(large.data(), large.size());
+    pn_value_t  x;
+    pn_error_t  error;
+    ASSERT_THAT(pn_parse_arena(&in, arena, &x, &error), Eq(true));
+    ASSERT_THAT(x.type, Eq(PN_MAP));
+    EXPECT_THAT(x.m->count, Eq(10000u));
+    EXPECT_THAT(pn_mapget_const(x.m, 's', "k0"), Pointee(IsValue(*set('i', -1).c_obj())));
+    EXPECT_THAT(
+            pn_mapget_const(x.m, 's', "k1"),
+            Pointee(IsValue(*setv("s$", "x", "\1\2", static_cast<size_t>(2)).c_obj())));
+    pn_input_close(&in);
+    pn_arena_free(arena);
+
+    arena = pn_arena_new();
+    in    = pn_view_input("[1, 2", 5);
+    EXPECT_THAT(pn_parse_arena(&in, arena, &x, &error), Eq(false));
+    EXPECT_THAT(error.code, Eq(PN_ERROR_ARRAY_END));
+    pn_input_close(&in);
+    pn_arena_free(arena);
+}
+
+// Counts calls to the allocator that return memory, as the benchmarks' allocs/op does.
+struct CallCounter {
+    static void* alloc(void* context, size_t size) {
+        ++static_cast<CallCounter*>(context)->calls;
+        return malloc(size);
+    }
+    static void* realloc(void* context, void* ptr, size_t size) {
+        ++static_cast<CallCounter*>(context)->calls;
+        return ::realloc(ptr, size);
+    }
+    static void free(void* context, void* ptr) { ::free(ptr); }
+
+    int calls = 0;
+};
+
+TEST_F(ParseTest, ArenaAllocations) {
+    std::string doc;
+    for (int i = 0; i < 10000; ++i) {
+        doc += "k" + std::to_string(i) + ":\n  * \"v\\t" + std::to_string(i) +
+               "\"\n  * $0102\n  * >  long\n    >  text\n";
+    }
+
+    // Leaves go straight into the arena, and the parser's own buffers only grow, so the count
+    // depends on the size of the document rather than the number of values in it.
+    CallCounter    counts;
+    pn_allocator_t allocator = {
+            CallCounter::alloc, CallCounter::realloc, CallCounter::free, &counts};
+    pn_set_allocator(&allocator);
+    pn_arena_t* arena = pn_arena_new();
+    pn_input_t  in    = pn_view_input(doc.data(), doc.size());
+    pn_value_t  x;
+    pn_error_t  error;
+    EXPECT_THAT(pn_parse_arena(&in, arena, &x, &error), Eq(true));
+    EXPECT_THAT(x.m->count, Eq(10000u));
+    pn_input_close(&in);
+    pn_arena_free(arena);
+    pn_set_allocator(nullptr);
+    EXPECT_THAT(counts.calls, Lt(64));
+}
+
+TEST_F(ParseTest, Parallel) {
+    std::string map, array;
+    for (int i = 0; i < 20000; ++i) {
+        map += "k" + std::to_string(i % 15000) + ":\n  * \"" + std::string(i % 10, 'x') + "\"\n";
+        map += (i % 1000) ? "" : "# comment\n\n";
+        array += "* " + std::to_string(i) + "\n*\n  a: [1, 2]\n  b: |\n    | " + std::to_string(i) +
+                 "\n";
+    }
+
+    for (const std::string& in :
+         {std::string("one: 1\ntwo: 2\n"), map, array, "# leading\n\n" + map, "  " + map,
+          map + array, map + "k0: [\n", array.substr(0, array.size() / 2) + "* \"\n" + array,
+          "x: 1\n" + array}) {
+        pn_input_t expected_in = pn_view_input(in.data(), in.size());
+        pn::value  expected;
+        pn_error_t expected_error = {};
+        bool       expected_ok    = pn_parse(&expected_in, expected.c_obj(), &expected_error);
+        pn_input_close(&expected_in);
+
+        pn_input_t parallel_in = pn_view_input(in.data(), in.size());
+        pn::value  x;
+        pn_error_t error = {};
+        EXPECT_THAT(pn_parse_parallel(&parallel_in, 4, x.c_obj(), &error), Eq(expected_ok));
+        if (expected_ok) {
+            EXPECT_THAT(pn_cmp(x.c_obj(), expected.c_obj()), Eq(0)) << in.substr(0, 100);
+            EXPECT_THAT(pn_input_eof(&parallel_in), Eq(true));
+        } else {
+            EXPECT_THAT(error.code, Eq(expected_error.code));
+            EXPECT_THAT(error.lineno, Eq(expected_error.lineno));
+            EXPECT_THAT(error.column, Eq(expected_error.column));
+        }
+        pn_input_close(&parallel_in);
+    }
+}
+
+// If `skip` is set, skips arrays and maps with that key, or with none if it's empty, except the
+// outermost.
+std::vector<std::string> events(const std::string& arg, const char* skip = nullptr) {
+    std::vector<std::string> result;
+    pn_input_t               in = pn_view_input(arg.data(), arg.size());
+    pn_error_t               error;
+    {
+        pn::event_reader r{in};
+        bool             ok = r.next(&error);
+        while (ok) {
+            std::string key = r.key().is_null() ? "" : r.key().as_string().copy().c_str();
+            std::string evt = r.key().is_null() ? "" : key + "=";
+            switch (r.type()) {
+                case PN_EVT_ARRAY_IN: evt += r.is_long() ? "*[" : "["; break;
+                case PN_EVT_ARRAY_OUT: evt += "]"; break;
+                case PN_EVT_MAP_IN: evt += r.is_long() ? "*{" : "{"; break;
+                case PN_EVT_MAP_OUT: evt += "}"; break;
+                default: evt += pn::dump(r.scalar(), pn::dump_short).c_str(); break;
+            }
+            bool skipped = skip && !result.empty() && (key == skip) &&
+                           ((r.type() == PN_EVT_ARRAY_IN) || (r.type() == PN_EVT_MAP_IN));
+            result.push_back(evt);
+            ok = skipped ? r.skip(&error) : r.next(&error);
+        }
+        if (r.type() == PN_EVT_ERROR) {
+            result.push_back(pn_strerror(error.code));
+        }
+    }
+    pn_input_close(&in);
+    return result;
+}
+
+TEST_F(ParseTest, Events) {
+    using v = std::vector<std::string>;
+    EXPECT_THAT(events("null"), Eq(v{"null"}));
+    EXPECT_THAT(events("[1, \"two\", $03]"), Eq(v{"[", "1", "\"two\"", "$03", "]"}));
+    EXPECT_THAT(
+            events("a: 1\n"
+                   "b:\n"
+                   "  * | line\n"
+                   "  * {c: true, d: []}\n"),
+            Eq(v{"*{", "a=1", "b=*[", "\"line\\n\"", "{", "c=true", "d=[", "]", "}", "]", "}"}));
+    EXPECT_THAT(events("[1, 2"), Eq(v{"[", "1", "2", pn_strerror(PN_ERROR_ARRAY_END)}));
+}
+
+TEST_F(ParseTest, Skip) {
+    using v = std::vector<std::string>;
+    EXPECT_THAT(
+            events("a: 1\n"
+                   "b:\n"
+                   "  c: 2\n"
+                   "\n"
+                   "  d:\n"
+                   "    * 3\n"
+                   "e: 4\n",
+                   "b"),
+            Eq(v{"*{", "a=1", "b=*{", "}", "e=4", "}"}));
+    EXPECT_THAT(events("a:\n  * 1\n  * 2", "a"), Eq(v{"*{", "a=*[", "]", "}"}));
+    EXPECT_THAT(events("* * 1\n  * 2\n* 3\n", ""), Eq(v{"*[", "*[", "]", "3", "]"}));
+    EXPECT_THAT(
+            events("a: [1, \"]\\\"\", {b: [2]}]\nc: 3", "a"),
+            Eq(v{"*{", "a=[", "]", "c=3", "}"}));
+    EXPECT_THAT(
+            events("[1, {x: [2, [3]], y: {}}, 4]", "x"),
+            Eq(v{"[", "1", "{", "x=[", "]", "y={", "}", "}", "4", "]"}));
+    EXPECT_THAT(events("{\"\": {a: 1}}", ""), Eq(v{"{", "={", "}", "}"}));
+
+    // Skipped contents aren't checked.
+    EXPECT_THAT(
+            events("a:\n  b: }\nc: [1, 2 3]\n", "a"),
+            Eq(v{"*{", "a=*{", "}", "c=[", "1", "2", pn_strerror(PN_ERROR_ARRAY_END)}));
+    EXPECT_THAT(events("a: [1 2]\n", "a"), Eq(v{"*{", "a=[", "]", "}"}));
+
+    // Errors around skipped containers are, as are unclosed or mismatched short-form ones.
+    EXPECT_THAT(
+            events("a:\n    b: 1\n  c: 2\n", "a"),
+            Eq(v{"*{", "a=*{", "}", pn_strerror(PN_ERROR_OUTDENT)}));
+    EXPECT_THAT(
+            events("a: [1, 2\nb: 3", "a"), Eq(v{"*{", "a=[", pn_strerror(PN_ERROR_ARRAY_END)}));
+    EXPECT_THAT(events("a: [1, {]}\n", "a"), Eq(v{"*{", "a=[", pn_strerror(PN_ERROR_MAP_KEY)}));
+    EXPECT_THAT(events("a: [\"]\n", "a"), Eq(v{"*{", "a=[", pn_strerror(PN_ERROR_STREOL)}));
+}
+
 }  // namespace
 }  // namespace pntest
@@ -77,6 +77,34 @@ TEST_F(StringTest, AllRunes) {
     EXPECT_THAT(rev_runes("\300\200"), ElementsAre(0xFFFD, 0xFFFD));
 }
 
+TEST_F(StringTest, AsciiSpan) {
+    // Each byte that ends a run, at each position in and around a word.
+    for (int stop : {'\0', '\t', '\037', '\177', '\200', '\377'}) {
+        for (int size = 0; size <= 20; ++size) {
+            for (int at = 0; at <= size; ++at) {
+                std::string s(size, 'x');
+                if (size) {
+                    s.front() = ' ';
+                    s.back()  = '~';
+                }
+                if (at < size) {
+                    s[at] = stop;
+                }
+                EXPECT_THAT(pn_ascii_span(s.data(), s.size()), Eq(std::min(at, size)))
+                        << stop << " " << size << " " << at;
+            }
+        }
+    }
+
+    pn::string_view s = "0123456789 \343\201\213 0123456789 \t 0123456789";
+    EXPECT_THAT(pn_str_width(s.data(), s.size()), Eq(37));
+    EXPECT_THAT(pn::rune::count(s), Eq(36));
+    EXPECT_THAT(pn::rune::slice(s, 9, 3), IsString("9 \343\201\213"));
+    EXPECT_THAT(pn::rune::slice(s, 13, 10), IsString("0123456789"));
+    EXPECT_THAT(pn::rune::slice(s, 34), IsString("89"));
+    EXPECT_THAT(pn::rune::slice(s, 40), IsString(""));
+}
+
 TEST_F(StringTest, Iterator) {
     pn::string_view s = "\1\2\3\4";
 
@@ -401,4 +401,22 @@ TEST_F(Utf8Test, Category) {
     }
 }
 
+TEST_F(Utf8Test, InlineCategory) {
+    for (uint32_t r = 0; r <= 0x110000; ++r) {
+        ASSERT_THAT(pn_rune_width_inline(r), Eq(pn_rune_width(r))) << r;
+        ASSERT_THAT(pn_isrune_inline(r), Eq(pn_isrune(r))) << r;
+        ASSERT_THAT(pn_isalnum_inline(r), Eq(pn_isalnum(r))) << r;
+        ASSERT_THAT(pn_isalpha_inline(r), Eq(pn_isalpha(r))) << r;
+        ASSERT_THAT(pn_iscntrl_inline(r), Eq(pn_iscntrl(r))) << r;
+        ASSERT_THAT(pn_isdigit_inline(r), Eq(pn_isdigit(r))) << r;
+        ASSERT_THAT(pn_islower_inline(r), Eq(pn_islower(r))) << r;
+        ASSERT_THAT(pn_isnumeric_inline(r), Eq(pn_isnumeric(r))) << r;
+        ASSERT_THAT(pn_isprint_inline(r), Eq(pn_isprint(r))) << r;
+        ASSERT_THAT(pn_ispunct_inline(r), Eq(pn_ispunct(r))) << r;
+        ASSERT_THAT(pn_isspace_inline(r), Eq(pn_isspace(r))) << r;
+        ASSERT_THAT(pn_isupper_inline(r), Eq(pn_isupper(r))) << r;
+        ASSERT_THAT(pn_istitle_inline(r), Eq(pn_istitle(r))) << r;
+    }
+}
+
 }  // namespace pntest
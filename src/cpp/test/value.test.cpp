@@ -18,12 +18,14 @@
 
 #include <gmock/gmock.h>
 #include <limits>
+#include <string>
 
 #include "./matchers.hpp"
 
 using ValueTest = ::testing::Test;
 using ::testing::Eq;
 using ::testing::Not;
+using ::testing::Pointee;
 
 namespace pntest {
 
@@ -357,6 +359,74 @@ TEST_F(ValueTest, Map) {
     EXPECT_THAT(x, IsMap("one", 1, "two", 2, "three", 3));
 }
 
+TEST_F(ValueTest, LargeMap) {
+    pn::value x = setkv("");
+    for (int i = 0; i < 1000; ++i) {
+        std::string key = std::to_string(i);
+        EXPECT_THAT(pn_mapset(&x.c_obj()->m, 's', 'i', key.c_str(), i), Eq(true));
+    }
+    EXPECT_THAT(pn_mapset(&x.c_obj()->m, 's', 'i', "500", -500), Eq(false));
+    EXPECT_THAT(x.c_obj()->m->count, Eq(1000u));
+
+    for (int i = 0; i < 1000; ++i) {
+        std::string key = std::to_string(i);
+        EXPECT_THAT(pn_mapget(x.c_obj()->m, 's', key.c_str()), Pointee(match(i == 500 ? -i : i)));
+    }
+    EXPECT_THAT(pn_mapget(x.c_obj()->m, 's', "1000"), ::testing::IsNull());
+    EXPECT_THAT(pn_mapget_const(x.c_obj()->m, 's', "-1"), ::testing::IsNull());
+
+    for (int i = 0; i < 1000; i += 2) {
+        std::string key = std::to_string(i);
+        EXPECT_THAT(pn_mapdel(&x.c_obj()->m, 's', key.c_str()), Eq(true));
+    }
+    pn::value y;
+    pn_set(y.c_obj(), 'm', x.c_obj()->m);
+    for (int i = 0; i < 1000; ++i) {
+        std::string key = std::to_string(i);
+        if (i % 2) {
+            EXPECT_THAT(pn_mapget_const(y.c_obj()->m, 's', key.c_str()), Pointee(match(i)));
+        } else {
+            EXPECT_THAT(pn_mapget_const(y.c_obj()->m, 's', key.c_str()), ::testing::IsNull());
+        }
+    }
+    EXPECT_THAT(x.c_obj()->m->values[0].key, IsString("1"));
+    EXPECT_THAT(x.c_obj()->m->values[499].key, IsString("999"));
+}
+
+TEST_F(ValueTest, LargeMapChurn) {
+    pn::value x = setkv("");
+    for (int i = 0; i < 100; ++i) {
+        pn_mapset(&x.c_obj()->m, 's', 'i', std::to_string(i).c_str(), i);
+    }
+
+    // Remove entries from both ends and the middle, and add them back, many times over.
+    for (int round = 0; round < 50; ++round) {
+        for (int i : {0, 99, 50}) {
+            pn_value_t  popped;
+            std::string key = std::to_string(i);
+            ASSERT_THAT(pn_mappop(&x.c_obj()->m, &popped, 's', key.c_str()), Eq(true));
+            EXPECT_THAT(pn_mapget(x.c_obj()->m, 's', key.c_str()), ::testing::IsNull());
+            EXPECT_THAT(pn_mappop(&x.c_obj()->m, &popped, 's', key.c_str()), Eq(false));
+            EXPECT_THAT(pn_mapset(&x.c_obj()->m, 's', 'i', key.c_str(), i), Eq(true));
+        }
+    }
+    ASSERT_THAT(x.c_obj()->m->count, Eq(100u));
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_THAT(
+                pn_mapget_const(x.c_obj()->m, 's', std::to_string(i).c_str()), Pointee(match(i)));
+    }
+    EXPECT_THAT(x.c_obj()->m->values[96].key, IsString("98"));
+    EXPECT_THAT(x.c_obj()->m->values[97].key, IsString("0"));
+    EXPECT_THAT(x.c_obj()->m->values[98].key, IsString("99"));
+    EXPECT_THAT(x.c_obj()->m->values[99].key, IsString("50"));
+
+    // Shrink below the size that carries an index.
+    for (int i = 1; i < 98; ++i) {
+        EXPECT_THAT(pn_mapdel(&x.c_obj()->m, 's', std::to_string(i).c_str()), Eq(true));
+    }
+    EXPECT_THAT(x, IsMap("98", 98, "0", 0, "99", 99));
+}
+
 TEST_F(ValueTest, Invalid) {
     // Invalid formatting characters.
     EXPECT_THAT(set('\0'), IsNull());
@@ -380,4 +450,47 @@ TEST_F(ValueTest, StrCompare) {
     EXPECT_THAT(pn_strcmp(set('s', "a").c_obj()->s, set('s', "a").c_obj()->s), Eq(0));
 }
 
+struct CountingAllocator {
+    static void* alloc(void* context, size_t size) {
+        ++static_cast<CountingAllocator*>(context)->live;
+        return malloc(size);
+    }
+    static void* realloc(void* context, void* ptr, size_t size) {
+        ++static_cast<CountingAllocator*>(context)->reallocs;
+        return ::realloc(ptr, size);
+    }
+    static void free(void* context, void* ptr) {
+        --static_cast<CountingAllocator*>(context)->live;
+        ::free(ptr);
+    }
+
+    int live     = 0;
+    int reallocs = 0;
+};
+
+TEST_F(ValueTest, Allocator) {
+    CountingAllocator counts;
+    pn_allocator_t    allocator = {
+            CountingAllocator::alloc, CountingAllocator::realloc, CountingAllocator::free,
+            &counts};
+    pn_set_allocator(&allocator);
+    EXPECT_THAT(pn_get_allocator()->context, Eq(&counts));
+
+    {
+        pn::value x =
+                setkv("sasm", "a", setv("ss", "b", "c").c_obj()->a, "d", setkv("").c_obj()->m);
+        EXPECT_THAT(counts.live, Eq(7));  // map, 2 keys, array, 2 strings, map
+        pn::value y = set('x', x.c_obj());
+        EXPECT_THAT(counts.live, Eq(14));
+
+        pn::string s{"string"};
+        s += " extended";
+        EXPECT_THAT(counts.reallocs, Eq(1));
+    }
+    EXPECT_THAT(counts.live, Eq(0));
+
+    pn_set_allocator(nullptr);
+    EXPECT_THAT(pn_get_allocator()->context, Eq(nullptr));
+}
+
 }  // namespace pntest